@@ -13,14 +13,396 @@
 #include "Core.h"
 #include "Modules/ModuleManager.h"
 #include "Interfaces/IPluginManager.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
 #include <cstdlib>
 
+#if WITH_GAMELIFT
+#include <rapidjson/document.h>
+#endif
+
 #define LOCTEXT_NAMESPACE "FGameLiftServerSDKModule"
 
 void* FGameLiftServerSDKModule::GameLiftServerSDKLibraryHandle = nullptr;
 
 static FProcessParameters GameLiftProcessParameters;
 
+// Published by the SDK callback thread, read from any thread. The lock only guards the pointer swap.
+static FCriticalSection MatchmakerDataLock;
+static FGameLiftMatchmakerDataPtr CurrentMatchmakerData;
+
+template <typename FOutcomeT>
+static void CompleteOnGameThread(const TFunction<void(FOutcomeT)>& OnComplete, FOutcomeT Outcome)
+{
+    if (!OnComplete)
+    {
+        return;
+    }
+
+    AsyncTask(ENamedThreads::GameThread, [OnComplete, Outcome = MoveTemp(Outcome)]() mutable
+    {
+        OnComplete(MoveTemp(Outcome));
+    });
+}
+
+#if WITH_GAMELIFT
+// FString -> UTF-8 for SDK arguments. Every SDK setter copies its argument before returning, so a single
+// scratch buffer per thread serves every field of every call. It only grows, so once warmed up no
+// argument conversion allocates, unlike a TCHAR_TO_UTF8 temporary per field.
+class FGameLiftUtf8Scratch
+{
+public:
+    // The result stays valid until the next Convert on the same thread, so use it for one argument at a time.
+    const char* Convert(const FString& Value)
+    {
+        const int32 SourceLength = Value.Len();
+        const int32 Utf8Length = FPlatformString::ConvertedLength<UTF8CHAR>(*Value, SourceLength);
+        Buffer.SetNumUninitialized(Utf8Length + 1, EAllowShrinking::No);
+        FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Buffer.GetData()), Utf8Length, *Value, SourceLength);
+        Buffer[Utf8Length] = 0;
+        return Buffer.GetData();
+    }
+
+    static FGameLiftUtf8Scratch& Get()
+    {
+        static thread_local FGameLiftUtf8Scratch Scratch;
+        return Scratch;
+    }
+
+private:
+    TArray<ANSICHAR> Buffer;
+};
+
+// UTF-8 -> FString for SDK results, converting straight into Out's character array with no temporary.
+static void AssignUtf8(FString& Out, const char* Utf8, int32 Utf8Length)
+{
+    const int32 Length = Utf8Length > 0 ? FPlatformString::ConvertedLength<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Utf8), Utf8Length) : 0;
+    if (Length <= 0) {
+        Out.Reset();
+        return;
+    }
+
+    auto& Chars = Out.GetCharArray();
+    Chars.SetNumUninitialized(Length + 1, EAllowShrinking::No);
+    FPlatformString::Convert(Chars.GetData(), Length, reinterpret_cast<const UTF8CHAR*>(Utf8), Utf8Length);
+    Chars[Length] = TEXT('\0');
+}
+
+static void AssignUtf8(FString& Out, const char* Utf8)
+{
+    AssignUtf8(Out, Utf8, Utf8 ? FCStringAnsi::Strlen(Utf8) : 0);
+}
+
+static FGameLiftGenericOutcome ToGenericOutcome(const Aws::GameLift::GenericOutcome& outcome) {
+    if (outcome.IsSuccess()) {
+        return FGameLiftGenericOutcome(nullptr);
+    }
+    else {
+        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    }
+}
+
+static FGameLiftStringOutcome ToStartMatchBackfillOutcome(const Aws::GameLift::StartMatchBackfillOutcome& outcome) {
+    if (outcome.IsSuccess()) {
+        return FGameLiftStringOutcome(outcome.GetResult().GetTicketId());
+    }
+    else {
+        return FGameLiftStringOutcome(FGameLiftError(outcome.GetError()));
+    }
+}
+
+static FGameLiftDescribePlayerSessionsOutcome ToDescribePlayerSessionsOutcome(const Aws::GameLift::DescribePlayerSessionsOutcome& outcome) {
+    if (outcome.IsSuccess()) {
+        auto& outres = outcome.GetResult();
+        FGameLiftDescribePlayerSessionsResult result;
+  
+        int sessionCount = 0;
+        auto sessions = outres.GetPlayerSessions(sessionCount);
+        if (sessionCount > 0) {
+            TArray<FGameLiftPlayerSession> outSessions;
+            outSessions.Reserve(sessionCount);
+
+            for (int i = 0; i < sessionCount; ++i) {
+                auto session = sessions + i;
+                FGameLiftPlayerSession& outSession = outSessions.AddDefaulted_GetRef();
+
+                AssignUtf8(outSession.m_playerSessionId, session->GetPlayerSessionId());
+                AssignUtf8(outSession.m_playerId, session->GetPlayerId());
+                AssignUtf8(outSession.m_gameSessionId, session->GetGameSessionId());
+                AssignUtf8(outSession.m_fleetId, session->GetFleetId());
+                outSession.m_creationTime = session->GetCreationTime();
+                outSession.m_terminationTime = session->GetTerminationTime();
+
+                switch (session->GetStatus()) {
+                    case Aws::GameLift::Server::Model::PlayerSessionStatus::NOT_SET: outSession.m_status = EPlayerSessionStatus::NOT_SET; break;
+                    case Aws::GameLift::Server::Model::PlayerSessionStatus::RESERVED: outSession.m_status = EPlayerSessionStatus::RESERVED; break;
+                    case Aws::GameLift::Server::Model::PlayerSessionStatus::ACTIVE: outSession.m_status = EPlayerSessionStatus::ACTIVE; break;
+                    case Aws::GameLift::Server::Model::PlayerSessionStatus::COMPLETED: outSession.m_status = EPlayerSessionStatus::COMPLETED; break;
+                    case Aws::GameLift::Server::Model::PlayerSessionStatus::TIMEDOUT: outSession.m_status = EPlayerSessionStatus::TIMEDOUT; break;
+                }
+
+                AssignUtf8(outSession.m_ipAddress, session->GetIpAddress());
+                outSession.m_port = session->GetPort();
+
+                AssignUtf8(outSession.m_playerData, session->GetPlayerData());
+                AssignUtf8(outSession.m_dnsName, session->GetDnsName());
+            }
+
+            result.m_playerSessions = MoveTemp(outSessions);
+        }
+
+        AssignUtf8(result.m_nextToken, outres.GetNextToken());
+
+        return FGameLiftDescribePlayerSessionsOutcome(MoveTemp(result));
+    }
+    else {
+        return FGameLiftDescribePlayerSessionsOutcome(FGameLiftError(outcome.GetError()));
+    }
+}
+
+static FGameLiftGetComputeCertificateOutcome ToGetComputeCertificateOutcome(const Aws::GameLift::GetComputeCertificateOutcome& outcome) {
+    if (outcome.IsSuccess()) {
+        auto& outres = outcome.GetResult();
+        FGameLiftGetComputeCertificateResult result;
+        AssignUtf8(result.m_certificate_path, outres.GetCertificatePath());
+        AssignUtf8(result.m_computeName, outres.GetComputeName());
+        return FGameLiftGetComputeCertificateOutcome(MoveTemp(result));
+    }
+    else {
+        return FGameLiftGetComputeCertificateOutcome(FGameLiftError(outcome.GetError()));
+    }
+}
+
+static FGameLiftGetFleetRoleCredentialsOutcome ToGetFleetRoleCredentialsOutcome(const Aws::GameLift::GetFleetRoleCredentialsOutcome& outcome) {
+    if (outcome.IsSuccess()) {
+        auto& outres = outcome.GetResult();
+        FGameLiftGetFleetRoleCredentialsResult result;
+        AssignUtf8(result.m_assumedUserRoleArn, outres.GetAssumedUserRoleArn());
+        AssignUtf8(result.m_assumedRoleId, outres.GetAssumedRoleId());
+        AssignUtf8(result.m_accessKeyId, outres.GetAccessKeyId());
+        AssignUtf8(result.m_secretAccessKey, outres.GetSecretAccessKey());
+        AssignUtf8(result.m_sessionToken, outres.GetSessionToken());
+        result.m_expiration = FDateTime::FromUnixTimestamp(outres.GetExpiration());
+        return FGameLiftGetFleetRoleCredentialsOutcome(MoveTemp(result));
+    }
+    else {
+        return FGameLiftGetFleetRoleCredentialsOutcome(FGameLiftError(outcome.GetError()));
+    }
+}
+
+static Aws::GameLift::Server::Model::DescribePlayerSessionsRequest ToSdkDescribePlayerSessionsRequest(const FGameLiftDescribePlayerSessionsRequest& describePlayerSessionsRequest) {
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
+    Aws::GameLift::Server::Model::DescribePlayerSessionsRequest request;
+    request.SetGameSessionId(Utf8.Convert(describePlayerSessionsRequest.m_gameSessionId));
+    request.SetPlayerId(Utf8.Convert(describePlayerSessionsRequest.m_playerId));
+    request.SetPlayerSessionId(Utf8.Convert(describePlayerSessionsRequest.m_playerSessionId));
+    request.SetPlayerSessionStatusFilter(Utf8.Convert(describePlayerSessionsRequest.m_playerSessionStatusFilter));
+    request.SetLimit(describePlayerSessionsRequest.m_limit);
+    request.SetNextToken(Utf8.Convert(describePlayerSessionsRequest.m_nextToken));
+    return request;
+}
+
+static Aws::GameLift::Server::Model::StartMatchBackfillRequest ToSdkStartMatchBackfillRequest(const FStartMatchBackfillRequest& request) {
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
+    Aws::GameLift::Server::Model::StartMatchBackfillRequest sdkRequest;
+    sdkRequest.SetTicketId(Utf8.Convert(request.m_ticketId));
+    sdkRequest.SetGameSessionArn(Utf8.Convert(request.m_gameSessionArn));
+    sdkRequest.SetMatchmakingConfigurationArn(Utf8.Convert(request.m_matchmakingConfigurationArn));
+    for (const FPlayer& player : request.m_players) {
+        Aws::GameLift::Server::Model::Player sdkPlayer;
+        sdkPlayer.SetPlayerId(Utf8.Convert(player.m_playerId));
+        sdkPlayer.SetTeam(Utf8.Convert(player.m_team));
+        for (const TPair<FString, int32>& entry : player.m_latencyInMs) {
+            sdkPlayer.WithLatencyMs(Utf8.Convert(entry.Key), entry.Value);
+        }
+
+        std::map<std::string, Aws::GameLift::Server::Model::AttributeValue> sdkAttributeMap;
+        for (const TPair<FString, FAttributeValue>& attributeEntry : player.m_playerAttributes) {
+            const FAttributeValue& value = attributeEntry.Value;
+            Aws::GameLift::Server::Model::AttributeValue attribute;
+            switch (value.m_type)
+            {
+                case FAttributeType::STRING:
+                    attribute = Aws::GameLift::Server::Model::AttributeValue(Utf8.Convert(value.m_S));
+                break;
+                case FAttributeType::DOUBLE:
+                    attribute = Aws::GameLift::Server::Model::AttributeValue(value.m_N);
+                break;
+                case FAttributeType::STRING_LIST:
+                    attribute = Aws::GameLift::Server::Model::AttributeValue::ConstructStringList();
+                    for (const FString& sl : value.m_SL) {
+                        attribute.AddString(Utf8.Convert(sl));
+                    };
+                break;
+                case FAttributeType::STRING_DOUBLE_MAP:
+                    attribute = Aws::GameLift::Server::Model::AttributeValue::ConstructStringDoubleMap();
+                    for (const TPair<FString, double>& sdm : value.m_SDM) {
+                        attribute.AddStringAndDouble(Utf8.Convert(sdm.Key), sdm.Value);
+                    };
+                break;
+            }
+            sdkPlayer.WithPlayerAttribute(Utf8.Convert(attributeEntry.Key), attribute);
+        }
+        sdkRequest.AddPlayer(sdkPlayer);
+    }
+    return sdkRequest;
+}
+
+static Aws::GameLift::Server::Model::StopMatchBackfillRequest ToSdkStopMatchBackfillRequest(const FStopMatchBackfillRequest& request) {
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
+    Aws::GameLift::Server::Model::StopMatchBackfillRequest sdkRequest;
+    sdkRequest.SetTicketId(Utf8.Convert(request.m_ticketId));
+    sdkRequest.SetGameSessionArn(Utf8.Convert(request.m_gameSessionArn));
+    sdkRequest.SetMatchmakingConfigurationArn(Utf8.Convert(request.m_matchmakingConfigurationArn));
+    return sdkRequest;
+}
+
+static Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest ToSdkGetFleetRoleCredentialsRequest(const FGameLiftGetFleetRoleCredentialsRequest& request) {
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
+    Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest sdkRequest;
+    sdkRequest.SetRoleArn(Utf8.Convert(request.m_roleArn));
+    sdkRequest.SetRoleSessionName(Utf8.Convert(request.m_roleSessionName));
+    return sdkRequest;
+}
+
+static FString JsonToFString(const rapidjson::Value& value) {
+    if (!value.IsString()) {
+        return FString();
+    }
+    FString result;
+    AssignUtf8(result, value.GetString(), static_cast<int32>(value.GetStringLength()));
+    return result;
+}
+
+static FString JsonMemberToFString(const rapidjson::Value& object, const char* name) {
+    rapidjson::Value::ConstMemberIterator member = object.FindMember(name);
+    return member != object.MemberEnd() ? JsonToFString(member->value) : FString();
+}
+
+static bool ToAttributeValue(const rapidjson::Value& attribute, FAttributeValue& outValue) {
+    rapidjson::Value::ConstMemberIterator type = attribute.FindMember("attributeType");
+    rapidjson::Value::ConstMemberIterator value = attribute.FindMember("valueAttribute");
+    if (type == attribute.MemberEnd() || value == attribute.MemberEnd() || !type->value.IsString()) {
+        return false;
+    }
+
+    const char* typeName = type->value.GetString();
+    outValue.m_N = 0;
+    if (FCStringAnsi::Strcmp(typeName, "STRING") == 0 && value->value.IsString()) {
+        outValue.m_type = FAttributeType::STRING;
+        outValue.m_S = JsonToFString(value->value);
+    }
+    else if (FCStringAnsi::Strcmp(typeName, "DOUBLE") == 0 && value->value.IsNumber()) {
+        outValue.m_type = FAttributeType::DOUBLE;
+        outValue.m_N = value->value.GetDouble();
+    }
+    else if (FCStringAnsi::Strcmp(typeName, "STRING_LIST") == 0 && value->value.IsArray()) {
+        outValue.m_type = FAttributeType::STRING_LIST;
+        outValue.m_SL.Reserve(value->value.Size());
+        for (rapidjson::Value::ConstValueIterator item = value->value.Begin(); item != value->value.End(); ++item) {
+            outValue.m_SL.Add(JsonToFString(*item));
+        }
+    }
+    else if (FCStringAnsi::Strcmp(typeName, "STRING_DOUBLE_MAP") == 0 && value->value.IsObject()) {
+        outValue.m_type = FAttributeType::STRING_DOUBLE_MAP;
+        outValue.m_SDM.Reserve(value->value.MemberCount());
+        for (rapidjson::Value::ConstMemberIterator item = value->value.MemberBegin(); item != value->value.MemberEnd(); ++item) {
+            if (item->value.IsNumber()) {
+                outValue.m_SDM.Add(JsonToFString(item->name), item->value.GetDouble());
+            }
+        }
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+// Parses the FlexMatch matchmaker data once so game code never has to touch the raw JSON.
+// Returns null for sessions without (valid) matchmaker data.
+static FGameLiftMatchmakerDataPtr ParseMatchmakerData(const char* matchmakerData) {
+    if (matchmakerData == nullptr || matchmakerData[0] == 0) {
+        return nullptr;
+    }
+
+    rapidjson::Document document;
+    document.Parse(matchmakerData);
+    if (document.HasParseError() || !document.IsObject()) {
+        return nullptr;
+    }
+
+    TSharedRef<FGameLiftMatchmakerData, ESPMode::ThreadSafe> result = MakeShared<FGameLiftMatchmakerData, ESPMode::ThreadSafe>();
+    result->m_matchId = JsonMemberToFString(document, "matchId");
+    result->m_matchmakingConfigurationArn = JsonMemberToFString(document, "matchmakingConfigurationArn");
+    result->m_autoBackfillMode = JsonMemberToFString(document, "autoBackfillMode");
+    result->m_autoBackfillTicketId = JsonMemberToFString(document, "autoBackfillTicketId");
+
+    rapidjson::Value::ConstMemberIterator teams = document.FindMember("teams");
+    if (teams == document.MemberEnd() || !teams->value.IsArray()) {
+        return result;
+    }
+
+    result->m_teams.Reserve(teams->value.Size());
+    for (rapidjson::Value::ConstValueIterator team = teams->value.Begin(); team != teams->value.End(); ++team) {
+        if (!team->IsObject()) {
+            continue;
+        }
+        const int32 teamIndex = result->m_teams.Num();
+        FGameLiftMatchmakerTeam& outTeam = result->m_teams.AddDefaulted_GetRef();
+        outTeam.m_name = JsonMemberToFString(*team, "name");
+
+        rapidjson::Value::ConstMemberIterator players = team->FindMember("players");
+        if (players == team->MemberEnd() || !players->value.IsArray()) {
+            continue;
+        }
+
+        outTeam.m_players.Reserve(players->value.Size());
+        for (rapidjson::Value::ConstValueIterator player = players->value.Begin(); player != players->value.End(); ++player) {
+            if (!player->IsObject()) {
+                continue;
+            }
+            FPlayer& outPlayer = outTeam.m_players.AddDefaulted_GetRef();
+            outPlayer.m_playerId = JsonMemberToFString(*player, "playerId");
+            outPlayer.m_team = outTeam.m_name;
+
+            rapidjson::Value::ConstMemberIterator attributes = player->FindMember("attributes");
+            if (attributes != player->MemberEnd() && attributes->value.IsObject()) {
+                outPlayer.m_playerAttributes.Reserve(attributes->value.MemberCount());
+                for (rapidjson::Value::ConstMemberIterator attribute = attributes->value.MemberBegin(); attribute != attributes->value.MemberEnd(); ++attribute) {
+                    FAttributeValue value;
+                    if (attribute->value.IsObject() && ToAttributeValue(attribute->value, value)) {
+                        outPlayer.m_playerAttributes.Add(JsonToFString(attribute->name), MoveTemp(value));
+                    }
+                }
+            }
+
+            rapidjson::Value::ConstMemberIterator latencies = player->FindMember("latencyInMs");
+            if (latencies != player->MemberEnd() && latencies->value.IsObject()) {
+                outPlayer.m_latencyInMs.Reserve(latencies->value.MemberCount());
+                for (rapidjson::Value::ConstMemberIterator latency = latencies->value.MemberBegin(); latency != latencies->value.MemberEnd(); ++latency) {
+                    if (latency->value.IsInt()) {
+                        outPlayer.m_latencyInMs.Add(JsonToFString(latency->name), latency->value.GetInt());
+                    }
+                }
+            }
+
+            result->m_playerIndex.Add(outPlayer.m_playerId, TPair<int32, int32>(teamIndex, outTeam.m_players.Num() - 1));
+        }
+    }
+
+    return result;
+}
+
+static void PublishMatchmakerData(FGameLiftMatchmakerDataPtr matchmakerData) {
+    FScopeLock lock(&MatchmakerDataLock);
+    CurrentMatchmakerData = MoveTemp(matchmakerData);
+}
+
+static Aws::GameLift::Server::Model::PlayerSessionCreationPolicy ToSdkPlayerSessionCreationPolicy(EPlayerSessionCreationPolicy policy) {
+    return Aws::GameLift::Server::Model::PlayerSessionCreationPolicyMapper::GetPlayerSessionCreationPolicyForName(TCHAR_TO_UTF8(*GetNameForPlayerSessionCreationPolicy(policy)));
+}
+#endif
+
 void FGameLiftServerSDKModule::StartupModule()
 {
 }
@@ -86,16 +468,17 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::InitSDK() {
 
 FGameLiftGenericOutcome FGameLiftServerSDKModule::InitSDK(const FServerParameters &serverParameters) {
 #if WITH_GAMELIFT
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
     Aws::GameLift::Server::Model::ServerParameters sdkServerParameters;
-    sdkServerParameters.SetWebSocketUrl(TCHAR_TO_UTF8(*serverParameters.m_webSocketUrl));
-    sdkServerParameters.SetFleetId(TCHAR_TO_UTF8(*serverParameters.m_fleetId));
-    sdkServerParameters.SetProcessId(TCHAR_TO_UTF8(*serverParameters.m_processId));
-    sdkServerParameters.SetHostId(TCHAR_TO_UTF8(*serverParameters.m_hostId));
-    sdkServerParameters.SetAuthToken(TCHAR_TO_UTF8(*serverParameters.m_authToken));
-    sdkServerParameters.SetAwsRegion(TCHAR_TO_UTF8(*serverParameters.m_awsRegion));
-    sdkServerParameters.SetAccessKey(TCHAR_TO_UTF8(*serverParameters.m_accessKey));
-    sdkServerParameters.SetSecretKey(TCHAR_TO_UTF8(*serverParameters.m_secretKey));
-    sdkServerParameters.SetSessionToken(TCHAR_TO_UTF8(*serverParameters.m_sessionToken));
+    sdkServerParameters.SetWebSocketUrl(Utf8.Convert(serverParameters.m_webSocketUrl));
+    sdkServerParameters.SetFleetId(Utf8.Convert(serverParameters.m_fleetId));
+    sdkServerParameters.SetProcessId(Utf8.Convert(serverParameters.m_processId));
+    sdkServerParameters.SetHostId(Utf8.Convert(serverParameters.m_hostId));
+    sdkServerParameters.SetAuthToken(Utf8.Convert(serverParameters.m_authToken));
+    sdkServerParameters.SetAwsRegion(Utf8.Convert(serverParameters.m_awsRegion));
+    sdkServerParameters.SetAccessKey(Utf8.Convert(serverParameters.m_accessKey));
+    sdkServerParameters.SetSecretKey(Utf8.Convert(serverParameters.m_secretKey));
+    sdkServerParameters.SetSessionToken(Utf8.Convert(serverParameters.m_sessionToken));
 
     auto initSDKOutcome = Aws::GameLift::Server::InitSDK(sdkServerParameters);
     if (initSDKOutcome.IsSuccess()) {
@@ -139,7 +522,8 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::ActivateGameSession() {
 
 FGameLiftGenericOutcome FGameLiftServerSDKModule::AcceptPlayerSession(const FString& playerSessionId) {
 #if WITH_GAMELIFT
-    auto outcome = Aws::GameLift::Server::AcceptPlayerSession(TCHAR_TO_UTF8(*playerSessionId));
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
+    auto outcome = Aws::GameLift::Server::AcceptPlayerSession(Utf8.Convert(playerSessionId));
     if (outcome.IsSuccess()){
         return FGameLiftGenericOutcome(nullptr);
     }
@@ -153,7 +537,8 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::AcceptPlayerSession(const FStr
 
 FGameLiftGenericOutcome FGameLiftServerSDKModule::RemovePlayerSession(const FString& playerSessionId) {
 #if WITH_GAMELIFT
-    auto outcome = Aws::GameLift::Server::RemovePlayerSession(TCHAR_TO_UTF8(*playerSessionId));
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
+    auto outcome = Aws::GameLift::Server::RemovePlayerSession(Utf8.Convert(playerSessionId));
     if (outcome.IsSuccess()){
         return FGameLiftGenericOutcome(nullptr);
     }
@@ -183,73 +568,31 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::Destroy()
 FGameLiftDescribePlayerSessionsOutcome FGameLiftServerSDKModule::DescribePlayerSessions(const FGameLiftDescribePlayerSessionsRequest &describePlayerSessionsRequest)
 {
 #if WITH_GAMELIFT
-    Aws::GameLift::Server::Model::DescribePlayerSessionsRequest request;
-    request.SetGameSessionId(TCHAR_TO_UTF8(*describePlayerSessionsRequest.m_gameSessionId));
-    request.SetPlayerId(TCHAR_TO_UTF8(*describePlayerSessionsRequest.m_playerId));
-    request.SetPlayerSessionId(TCHAR_TO_UTF8(*describePlayerSessionsRequest.m_playerSessionId));
-    request.SetPlayerSessionStatusFilter(TCHAR_TO_UTF8(*describePlayerSessionsRequest.m_playerSessionStatusFilter));
-    request.SetLimit(describePlayerSessionsRequest.m_limit);
-    request.SetNextToken(TCHAR_TO_UTF8(*describePlayerSessionsRequest.m_nextToken));
-
-    auto outcome = Aws::GameLift::Server::DescribePlayerSessions(request);
-
-    if (outcome.IsSuccess()) {
-        auto& outres = outcome.GetResult();
-        FGameLiftDescribePlayerSessionsResult result;
-  
-        int sessionCount = 0;
-        auto sessions = outres.GetPlayerSessions(sessionCount);
-        if (sessionCount > 0) {
-            TArray<FGameLiftPlayerSession> outSessions;
-            outSessions.Reserve(sessionCount);
-
-            for (int i = 0; i < sessionCount; ++i) {
-                auto session = sessions + i;
-                FGameLiftPlayerSession& outSession = outSessions.AddDefaulted_GetRef();
-
-                outSession.m_playerSessionId = UTF8_TO_TCHAR(session->GetPlayerSessionId());
-                outSession.m_playerId = UTF8_TO_TCHAR(session->GetPlayerId());
-                outSession.m_gameSessionId = UTF8_TO_TCHAR(session->GetGameSessionId());
-                outSession.m_fleetId = UTF8_TO_TCHAR(session->GetFleetId());
-                outSession.m_creationTime = session->GetCreationTime();
-                outSession.m_terminationTime = session->GetTerminationTime();
-
-                switch (session->GetStatus()) {
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::NOT_SET: outSession.m_status = EPlayerSessionStatus::NOT_SET; break;
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::RESERVED: outSession.m_status = EPlayerSessionStatus::RESERVED; break;
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::ACTIVE: outSession.m_status = EPlayerSessionStatus::ACTIVE; break;
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::COMPLETED: outSession.m_status = EPlayerSessionStatus::COMPLETED; break;
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::TIMEDOUT: outSession.m_status = EPlayerSessionStatus::TIMEDOUT; break;
-                }
-
-                outSession.m_ipAddress = UTF8_TO_TCHAR(session->GetIpAddress());
-                outSession.m_port = session->GetPort();
-
-                outSession.m_playerData = UTF8_TO_TCHAR(session->GetPlayerData());
-                outSession.m_dnsName = UTF8_TO_TCHAR(session->GetDnsName());
-            }
-
-            result.m_playerSessions = outSessions;
-        }
-
-        result.m_nextToken = (UTF8_TO_TCHAR(outres.GetNextToken()));
-
-        return FGameLiftDescribePlayerSessionsOutcome(result);
-    }
-    else {
-        return FGameLiftDescribePlayerSessionsOutcome(FGameLiftError(outcome.GetError()));
-    }
+    auto outcome = Aws::GameLift::Server::DescribePlayerSessions(ToSdkDescribePlayerSessionsRequest(describePlayerSessionsRequest));
+    return ToDescribePlayerSessionsOutcome(outcome);
 #else
     return FGameLiftDescribePlayerSessionsOutcome(FGameLiftDescribePlayerSessionsResult());
 #endif
 }
 
+// The SDK invokes these on its callback strand, so matchmaker data is parsed here, before the delegates run
+// and off the game thread.
 static void OnActivateFunctionInternal(Aws::GameLift::Server::Model::GameSession gameSession, void* state) {
-    GameLiftProcessParameters.OnActivateFunction(gameSession);
+#if WITH_GAMELIFT
+    PublishMatchmakerData(ParseMatchmakerData(gameSession.GetMatchmakerData()));
+#endif
+    GameLiftProcessParameters.OnActivateFunction(std::move(gameSession));
 }
 
 static void OnUpdateFunctionInternal(Aws::GameLift::Server::Model::UpdateGameSession updateGameSession, void* state) {
-    GameLiftProcessParameters.OnUpdateFunction(updateGameSession);
+#if WITH_GAMELIFT
+    // Updates without matchmaker data keep the current view.
+    FGameLiftMatchmakerDataPtr matchmakerData = ParseMatchmakerData(updateGameSession.GetGameSession().GetMatchmakerData());
+    if (matchmakerData.IsValid()) {
+        PublishMatchmakerData(MoveTemp(matchmakerData));
+    }
+#endif
+    GameLiftProcessParameters.OnUpdateFunction(std::move(updateGameSession));
 }
 
 static void OnTerminateFunctionInternal(void* state) {
@@ -260,8 +603,10 @@ static bool OnHealthCheckInternal(void* state) {
     return GameLiftProcessParameters.OnHealthCheckFunction();
 }
 
-FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameters &processParameters) {
 #if WITH_GAMELIFT
+// Captures the delegates, publishes the SDK tool name/version and builds the SDK process parameters.
+// Must run on the game thread since it touches the plugin manager.
+static FGameLiftGenericOutcome BuildSdkProcessParameters(FProcessParameters &processParameters, Aws::GameLift::Server::ProcessParameters &outProcessParams) {
     GameLiftProcessParameters = processParameters;
 
 	char logPathsBuffer[MAX_LOG_PATHS][MAX_PATH_LENGTH];
@@ -325,7 +670,7 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameter
     putenv(const_cast<char*>(pluginVersionEnvStr.c_str()));
 #endif
 
-    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+    outProcessParams = Aws::GameLift::Server::ProcessParameters(
         OnActivateFunctionInternal,
         nullptr,
         OnUpdateFunctionInternal,
@@ -338,13 +683,20 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameter
         Aws::GameLift::Server::LogParameters(logPaths, numLogs)
         );
 
-    auto outcome = Aws::GameLift::Server::ProcessReady(processParams);
-    if (outcome.IsSuccess()){
-        return FGameLiftGenericOutcome(nullptr);
-    }
-    else {
-        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    return FGameLiftGenericOutcome(nullptr);
+}
+#endif
+
+FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameters &processParameters) {
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::ProcessParameters processParams;
+    FGameLiftGenericOutcome buildOutcome = BuildSdkProcessParameters(processParameters, processParams);
+    if (!buildOutcome.IsSuccess()) {
+        return buildOutcome;
     }
+
+    auto outcome = Aws::GameLift::Server::ProcessReady(processParams);
+    return ToGenericOutcome(outcome);
 #else
     return FGameLiftGenericOutcome(nullptr);
 #endif
@@ -353,14 +705,8 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameter
 FGameLiftGenericOutcome FGameLiftServerSDKModule::UpdatePlayerSessionCreationPolicy(EPlayerSessionCreationPolicy policy)
 {
 #if WITH_GAMELIFT
-    Aws::GameLift::Server::Model::PlayerSessionCreationPolicy internalPolicy = Aws::GameLift::Server::Model::PlayerSessionCreationPolicyMapper::GetPlayerSessionCreationPolicyForName(TCHAR_TO_UTF8(*GetNameForPlayerSessionCreationPolicy(policy)));
-    auto outcome = Aws::GameLift::Server::UpdatePlayerSessionCreationPolicy(internalPolicy);
-    if (outcome.IsSuccess()){
-        return FGameLiftGenericOutcome(nullptr);
-    }
-    else {
-        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
-    }
+    auto outcome = Aws::GameLift::Server::UpdatePlayerSessionCreationPolicy(ToSdkPlayerSessionCreationPolicy(policy));
+    return ToGenericOutcome(outcome);
 #else
     return FGameLiftGenericOutcome(nullptr);
 #endif
@@ -396,54 +742,8 @@ FGameLiftLongOutcome FGameLiftServerSDKModule::GetTerminationTime() {
 
 FGameLiftStringOutcome FGameLiftServerSDKModule::StartMatchBackfill(const FStartMatchBackfillRequest& request) {
 #if WITH_GAMELIFT
-    Aws::GameLift::Server::Model::StartMatchBackfillRequest sdkRequest;
-    sdkRequest.SetTicketId(TCHAR_TO_UTF8(*request.m_ticketId));
-    sdkRequest.SetGameSessionArn(TCHAR_TO_UTF8(*request.m_gameSessionArn));
-    sdkRequest.SetMatchmakingConfigurationArn(TCHAR_TO_UTF8(*request.m_matchmakingConfigurationArn));
-    for (auto player : request.m_players) {
-        Aws::GameLift::Server::Model::Player sdkPlayer;
-        sdkPlayer.SetPlayerId(TCHAR_TO_UTF8(*player.m_playerId));
-        sdkPlayer.SetTeam(TCHAR_TO_UTF8(*player.m_team));
-        for (auto entry : player.m_latencyInMs) {
-            sdkPlayer.WithLatencyMs(TCHAR_TO_UTF8(*entry.Key), entry.Value);
-        }
-
-        std::map<std::string, Aws::GameLift::Server::Model::AttributeValue> sdkAttributeMap;
-        for (auto attributeEntry : player.m_playerAttributes) {
-            FAttributeValue value = attributeEntry.Value;
-            Aws::GameLift::Server::Model::AttributeValue attribute;
-            switch (value.m_type)
-            {
-                case FAttributeType::STRING:
-                    attribute = Aws::GameLift::Server::Model::AttributeValue(TCHAR_TO_UTF8(*value.m_S));
-                break;
-                case FAttributeType::DOUBLE:
-                    attribute = Aws::GameLift::Server::Model::AttributeValue(value.m_N);
-                break;
-                case FAttributeType::STRING_LIST:
-                    attribute = Aws::GameLift::Server::Model::AttributeValue::ConstructStringList();
-                    for (auto sl : value.m_SL) {
-                        attribute.AddString(TCHAR_TO_UTF8(*sl));
-                    };
-                break;
-                case FAttributeType::STRING_DOUBLE_MAP:
-                    attribute = Aws::GameLift::Server::Model::AttributeValue::ConstructStringDoubleMap();
-                    for (auto sdm : value.m_SDM) {
-                        attribute.AddStringAndDouble(TCHAR_TO_UTF8(*sdm.Key), sdm.Value);
-                    };
-                break;
-            }
-            sdkPlayer.WithPlayerAttribute((TCHAR_TO_UTF8(*attributeEntry.Key)), attribute);
-        }
-        sdkRequest.AddPlayer(sdkPlayer);
-    }
-    auto outcome = Aws::GameLift::Server::StartMatchBackfill(sdkRequest);
-    if (outcome.IsSuccess()) {
-        return FGameLiftStringOutcome(outcome.GetResult().GetTicketId());
-    }
-    else {
-        return FGameLiftStringOutcome(FGameLiftError(outcome.GetError()));
-    }
+    auto outcome = Aws::GameLift::Server::StartMatchBackfill(ToSdkStartMatchBackfillRequest(request));
+    return ToStartMatchBackfillOutcome(outcome);
 #else
     return FGameLiftStringOutcome("");
 #endif
@@ -452,17 +752,8 @@ FGameLiftStringOutcome FGameLiftServerSDKModule::StartMatchBackfill(const FStart
 FGameLiftGenericOutcome FGameLiftServerSDKModule::StopMatchBackfill(const FStopMatchBackfillRequest& request)
 {
 #if WITH_GAMELIFT
-    Aws::GameLift::Server::Model::StopMatchBackfillRequest sdkRequest;
-    sdkRequest.SetTicketId(TCHAR_TO_UTF8(*request.m_ticketId));
-    sdkRequest.SetGameSessionArn(TCHAR_TO_UTF8(*request.m_gameSessionArn));
-    sdkRequest.SetMatchmakingConfigurationArn(TCHAR_TO_UTF8(*request.m_matchmakingConfigurationArn));
-    auto outcome = Aws::GameLift::Server::StopMatchBackfill(sdkRequest);
-    if (outcome.IsSuccess()) {
-        return FGameLiftGenericOutcome(nullptr);
-    }
-    else {
-        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
-    }
+    auto outcome = Aws::GameLift::Server::StopMatchBackfill(ToSdkStopMatchBackfillRequest(request));
+    return ToGenericOutcome(outcome);
 #else
     return FGameLiftGenericOutcome(nullptr);
 #endif
@@ -473,16 +764,7 @@ FGameLiftGetComputeCertificateOutcome FGameLiftServerSDKModule::GetComputeCertif
 {
 #if WITH_GAMELIFT
     auto outcome = Aws::GameLift::Server::GetComputeCertificate();
-    if (outcome.IsSuccess()) {
-        auto& outres = outcome.GetResult();
-        FGameLiftGetComputeCertificateResult result;
-        result.m_certificate_path = UTF8_TO_TCHAR(outres.GetCertificatePath());
-        result.m_computeName = UTF8_TO_TCHAR(outres.GetComputeName());
-        return FGameLiftGetComputeCertificateOutcome(result);
-    }
-    else {
-        return FGameLiftGetComputeCertificateOutcome(FGameLiftError(outcome.GetError()));
-    }
+    return ToGetComputeCertificateOutcome(outcome);
 #else
     return FGameLiftGetComputeCertificateOutcome(FGameLiftGetComputeCertificateResult());
 #endif
@@ -491,28 +773,148 @@ FGameLiftGetComputeCertificateOutcome FGameLiftServerSDKModule::GetComputeCertif
 FGameLiftGetFleetRoleCredentialsOutcome FGameLiftServerSDKModule::GetFleetRoleCredentials(const FGameLiftGetFleetRoleCredentialsRequest &request)
 {
 #if WITH_GAMELIFT
-    Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest sdkRequest;
-    sdkRequest.SetRoleArn(TCHAR_TO_UTF8(*request.m_roleArn));
-    sdkRequest.SetRoleSessionName(TCHAR_TO_UTF8(*request.m_roleSessionName));
+    auto outcome = Aws::GameLift::Server::GetFleetRoleCredentials(ToSdkGetFleetRoleCredentialsRequest(request));
+    return ToGetFleetRoleCredentialsOutcome(outcome);
+#else
+    return FGameLiftGetFleetRoleCredentialsOutcome(FGameLiftGetFleetRoleCredentialsResult());
+#endif
+}
 
-    auto outcome = Aws::GameLift::Server::GetFleetRoleCredentials(sdkRequest);
+FGameLiftMatchmakerDataPtr FGameLiftServerSDKModule::GetMatchmakerData() const
+{
+    FScopeLock lock(&MatchmakerDataLock);
+    return CurrentMatchmakerData;
+}
 
-    if (outcome.IsSuccess()) {
-        auto& outres = outcome.GetResult();
-        FGameLiftGetFleetRoleCredentialsResult result;
-        result.m_assumedUserRoleArn = UTF8_TO_TCHAR(outres.GetAssumedUserRoleArn());
-        result.m_assumedRoleId = UTF8_TO_TCHAR(outres.GetAssumedRoleId());
-        result.m_accessKeyId = UTF8_TO_TCHAR(outres.GetAccessKeyId());
-        result.m_secretAccessKey = UTF8_TO_TCHAR(outres.GetSecretAccessKey());
-        result.m_sessionToken = UTF8_TO_TCHAR(outres.GetSessionToken());
-        result.m_expiration = FDateTime::FromUnixTimestamp(outres.GetExpiration());
-        return FGameLiftGetFleetRoleCredentialsOutcome(result);
-    }
-    else {
-        return FGameLiftGetFleetRoleCredentialsOutcome(FGameLiftError(outcome.GetError()));
+void FGameLiftServerSDKModule::ProcessReadyAsync(FProcessParameters &processParameters, FGameLiftGenericOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::ProcessParameters processParams;
+    FGameLiftGenericOutcome buildOutcome = BuildSdkProcessParameters(processParameters, processParams);
+    if (!buildOutcome.IsSuccess()) {
+        CompleteOnGameThread(OnComplete, MoveTemp(buildOutcome));
+        return;
     }
+
+    Aws::GameLift::Server::ProcessReadyAsync(processParams, [OnComplete](const Aws::GameLift::GenericOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGenericOutcome(outcome));
+    });
 #else
-    return FGameLiftGetFleetRoleCredentialsOutcome(FGameLiftGetFleetRoleCredentialsResult());
+    CompleteOnGameThread(OnComplete, FGameLiftGenericOutcome(nullptr));
+#endif
+}
+
+void FGameLiftServerSDKModule::ProcessEndingAsync(FGameLiftGenericOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::ProcessEndingAsync([OnComplete](const Aws::GameLift::GenericOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGenericOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftGenericOutcome(nullptr));
+#endif
+}
+
+void FGameLiftServerSDKModule::ActivateGameSessionAsync(FGameLiftGenericOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::ActivateGameSessionAsync([OnComplete](const Aws::GameLift::GenericOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGenericOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftGenericOutcome(nullptr));
+#endif
+}
+
+void FGameLiftServerSDKModule::AcceptPlayerSessionAsync(const FString& playerSessionId, FGameLiftGenericOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
+    Aws::GameLift::Server::AcceptPlayerSessionAsync(Utf8.Convert(playerSessionId), [OnComplete](const Aws::GameLift::GenericOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGenericOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftGenericOutcome(nullptr));
+#endif
+}
+
+void FGameLiftServerSDKModule::RemovePlayerSessionAsync(const FString& playerSessionId, FGameLiftGenericOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    FGameLiftUtf8Scratch& Utf8 = FGameLiftUtf8Scratch::Get();
+    Aws::GameLift::Server::RemovePlayerSessionAsync(Utf8.Convert(playerSessionId), [OnComplete](const Aws::GameLift::GenericOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGenericOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftGenericOutcome(nullptr));
+#endif
+}
+
+void FGameLiftServerSDKModule::DescribePlayerSessionsAsync(const FGameLiftDescribePlayerSessionsRequest& describePlayerSessionsRequest, FGameLiftDescribePlayerSessionsOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    // The SDK result is converted to UE types on the worker thread; only the finished outcome crosses to the game thread.
+    Aws::GameLift::Server::DescribePlayerSessionsAsync(ToSdkDescribePlayerSessionsRequest(describePlayerSessionsRequest),
+        [OnComplete](const Aws::GameLift::DescribePlayerSessionsOutcome& outcome) {
+            CompleteOnGameThread(OnComplete, ToDescribePlayerSessionsOutcome(outcome));
+        });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftDescribePlayerSessionsOutcome(FGameLiftDescribePlayerSessionsResult()));
+#endif
+}
+
+void FGameLiftServerSDKModule::UpdatePlayerSessionCreationPolicyAsync(EPlayerSessionCreationPolicy policy, FGameLiftGenericOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::UpdatePlayerSessionCreationPolicyAsync(ToSdkPlayerSessionCreationPolicy(policy), [OnComplete](const Aws::GameLift::GenericOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGenericOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftGenericOutcome(nullptr));
+#endif
+}
+
+void FGameLiftServerSDKModule::StartMatchBackfillAsync(const FStartMatchBackfillRequest& request, FGameLiftStringOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::StartMatchBackfillAsync(ToSdkStartMatchBackfillRequest(request), [OnComplete](const Aws::GameLift::StartMatchBackfillOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToStartMatchBackfillOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftStringOutcome(""));
+#endif
+}
+
+void FGameLiftServerSDKModule::StopMatchBackfillAsync(const FStopMatchBackfillRequest& request, FGameLiftGenericOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::StopMatchBackfillAsync(ToSdkStopMatchBackfillRequest(request), [OnComplete](const Aws::GameLift::GenericOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGenericOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftGenericOutcome(nullptr));
+#endif
+}
+
+void FGameLiftServerSDKModule::GetComputeCertificateAsync(FGameLiftGetComputeCertificateOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::GetComputeCertificateAsync([OnComplete](const Aws::GameLift::GetComputeCertificateOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGetComputeCertificateOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftGetComputeCertificateOutcome(FGameLiftGetComputeCertificateResult()));
+#endif
+}
+
+void FGameLiftServerSDKModule::GetFleetRoleCredentialsAsync(const FGameLiftGetFleetRoleCredentialsRequest& request, FGameLiftGetFleetRoleCredentialsOutcomeCallback OnComplete)
+{
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::GetFleetRoleCredentialsAsync(ToSdkGetFleetRoleCredentialsRequest(request), [OnComplete](const Aws::GameLift::GetFleetRoleCredentialsOutcome& outcome) {
+        CompleteOnGameThread(OnComplete, ToGetFleetRoleCredentialsOutcome(outcome));
+    });
+#else
+    CompleteOnGameThread(OnComplete, FGameLiftGetFleetRoleCredentialsOutcome(FGameLiftGetFleetRoleCredentialsResult()));
 #endif
 }
 
@@ -39,6 +39,14 @@
 
 #include <aws/gamelift/internal/network/WebSocketppClientWrapper.h>
 #include <aws/gamelift/server/ProcessParameters.h>
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#endif
+#include <asio/steady_timer.hpp>
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
 #include <cstdlib>
 #include <ctime>
 #include <spdlog/spdlog.h>
@@ -57,24 +65,20 @@ using namespace Aws::GameLift;
 #ifdef GAMELIFT_USE_STD
 Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
     : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_processReady(false), m_terminationTime(-1),
-      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckThread(nullptr), m_healthCheckInterrupted(false),
+      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr),
       m_createGameSessionCallback(new CreateGameSessionCallback(this)), m_describePlayerSessionsCallback(new DescribePlayerSessionsCallback()),
       m_getComputeCertificateCallback(new GetComputeCertificateCallback()), m_getFleetRoleCredentialsCallback(new GetFleetRoleCredentialsCallback()),
       m_terminateProcessCallback(new TerminateProcessCallback(this)), m_updateGameSessionCallback(new UpdateGameSessionCallback(this)),
-      m_startMatchBackfillCallback(new StartMatchBackfillCallback()), m_refreshConnectionCallback(new RefreshConnectionCallback(this)) {}
+      m_startMatchBackfillCallback(new StartMatchBackfillCallback()), m_refreshConnectionCallback(new RefreshConnectionCallback(this)),
+      m_heartbeatScheduler(nullptr) {}
 
 Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
+    WaitForAsyncCalls();
     m_processReady = false;
-    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
-        {
-            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-            m_healthCheckInterrupted = true;
-            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
-            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
-            // the thread will continue without waiting the full ~60 second interval.
-            m_healthCheckConditionVariable.notify_all();
-        }
-        m_healthCheckThread->join();
+    if (m_heartbeatScheduler) {
+        // Cancels the next beat now rather than when it was due, and waits out a heartbeat in flight.
+        m_heartbeatScheduler->Stop();
+        m_heartbeatScheduler.reset();
     }
 
     Aws::GameLift::Internal::GameLiftCommonState::SetInstance(nullptr);
@@ -94,133 +98,26 @@ Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
     m_webSocketClientWrapper = nullptr;
 }
 
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters) {
-    spdlog::info("Calling ProcessReady");
-
+void Aws::GameLift::Internal::GameLiftServerState::SetProcessCallbacks(const Aws::GameLift::Server::ProcessParameters &processParameters) {
     m_onStartGameSession = processParameters.getOnStartGameSession();
     m_onUpdateGameSession = processParameters.getOnUpdateGameSession();
     m_onProcessTerminate = processParameters.getOnProcessTerminate();
     m_onHealthCheck = processParameters.getOnHealthCheck();
-
-    if (processParameters.getPort() < 0 || processParameters.getPort() > 65535) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Port number is invalid."));
-    }
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    const char* sdkToolNameEnvironmentVariable = std::getenv(ENV_VAR_SDK_TOOL_NAME);
-    const char* sdkToolVersionEnvironmentVariable = std::getenv(ENV_VAR_SDK_TOOL_VERSION);
-
-    std::string sdkToolName = sdkToolNameEnvironmentVariable == nullptr ? "" : sdkToolNameEnvironmentVariable;
-    std::string sdkToolVersion = sdkToolVersionEnvironmentVariable == nullptr ? "" : sdkToolVersionEnvironmentVariable;
-
-    Aws::GameLift::Internal::ActivateServerProcessRequest activateServerProcessRequest(Server::GetSdkVersion().GetResult(), Aws::GameLift::Internal::GameLiftServerState::LANGUAGE,
-                                                                        sdkToolName, sdkToolVersion,
-                                                                        processParameters.getPort(), processParameters.getLogParameters());
-    Aws::GameLift::Internal::Message &request = activateServerProcessRequest;
-
-    // SendSocketMessageWithRetries makes sync call
-    GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-
-    if (result.IsSuccess()) {
-        spdlog::info("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting m_healthCheckThread().");
-        m_processReady = true;
-        m_healthCheckThread = std::unique_ptr<std::thread>(new std::thread([this] { HealthCheck(); }));
-    } else {
-        spdlog::info("Error while executing ActivateServerProcess. See the root cause error for more information.");
-    }
-
-    return result;
-}
-
-void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
-    spdlog::info("Calling ReportHealth");
-    std::future<bool> future(std::async([]() { return true; }));
-    if (m_onHealthCheck) {
-        future = std::async(std::launch::async, m_onHealthCheck);
-    }
-
-    // Static variable not guaranteed to be defined (location in memory) at this point unless C++
-    // 17+. Creating temp int to pass by reference.
-    std::chrono::system_clock::time_point timeoutSeconds = std::chrono::system_clock::now() + std::chrono::milliseconds(int(HEALTHCHECK_TIMEOUT_MILLIS));
-    bool health = false;
-
-    // wait_until blocks until timeoutSeconds has been reached or the result becomes available
-    if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
-        health = future.get();
-        spdlog::info("Received Health Response: {} from Server Process: {}", health, m_processId);
-    } else {
-        spdlog::warn("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
-    }
-
-    Aws::GameLift::Internal::HeartbeatServerProcessRequest request = Aws::GameLift::Internal::HeartbeatServerProcessRequest().WithHealthy(health);
-    if (m_webSocketClientManager || m_webSocketClientWrapper) {
-        spdlog::info("Trying to report process health as {} for process {}", health, m_processId);
-        auto outcome = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-        if (!outcome.IsSuccess()) {
-	        spdlog::error("Error reporting process health for process {}.", m_processId);
-        }
-    } else {
-	    spdlog::error("Tried to report process health for process {} with no active connection", m_processId);
-    }
 }
 
-::GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessEnding() {
-    m_processReady = false;
-
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+void Aws::GameLift::Internal::GameLiftServerState::StartHealthCheck() {
+    std::function<bool()> onHealthCheck = m_onHealthCheck;
+    HeartbeatScheduler::HealthProbe probe = nullptr;
+    if (onHealthCheck) {
+        probe = [onHealthCheck]() { return onHealthCheck(); };
     }
-
-    Aws::GameLift::Internal::TerminateServerProcessRequest terminateServerProcessRequest;
-    Aws::GameLift::Internal::Message &request = terminateServerProcessRequest;
-    GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-
-    return result;
+    StartHeartbeatScheduler(probe);
 }
 
-std::string Aws::GameLift::Internal::GameLiftServerState::GetGameSessionId() const { return m_gameSessionId; }
+std::string Aws::GameLift::Internal::GameLiftServerState::GetGameSessionId() const { return CopyGameSessionId(); }
 
 long Aws::GameLift::Internal::GameLiftServerState::GetTerminationTime() const { return m_terminationTime; }
 
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ActivateGameSession() {
-    if (!m_processReady) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
-    }
-
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    Aws::GameLift::Internal::ActivateGameSessionRequest activateGameSessionRequest(m_gameSessionId);
-    Aws::GameLift::Internal::Message &request = activateGameSessionRequest;
-    GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-
-    return result;
-}
-
-GenericOutcome
-Aws::GameLift::Internal::GameLiftServerState::UpdatePlayerSessionCreationPolicy(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy) {
-    std::string newPlayerSessionPolicyInString =
-        Aws::GameLift::Server::Model::PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy);
-
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    if (m_gameSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
-    }
-
-    Aws::GameLift::Internal::UpdatePlayerSessionCreationPolicyRequest updatePlayerSessionCreationPolicyRequest(
-        m_gameSessionId, PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy));
-    Aws::GameLift::Internal::Message &request = updatePlayerSessionCreationPolicyRequest;
-    GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-
-    return result;
-}
-
 Server::InitSDKOutcome Aws::GameLift::Internal::GameLiftServerState::CreateInstance(std::shared_ptr<Internal::IWebSocketClientWrapper> webSocketClientWrapper) {
     if (GameLiftCommonState::GetInstance().IsSuccess()) {
         return Server::InitSDKOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::ALREADY_INITIALIZED));
@@ -237,42 +134,6 @@ Server::InitSDKOutcome Aws::GameLift::Internal::GameLiftServerState::CreateInsta
     return newState;
 }
 
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSession(const std::string &playerSessionId) {
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    if (m_gameSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
-    }
-
-    if (playerSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
-    }
-
-    AcceptPlayerSessionRequest request = AcceptPlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
-
-    return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-}
-
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSession(const std::string &playerSessionId) {
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    if (m_gameSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
-    }
-
-    if (playerSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
-    }
-
-    RemovePlayerSessionRequest request = RemovePlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
-
-    return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-}
-
 void Aws::GameLift::Internal::GameLiftServerState::OnStartGameSession(Aws::GameLift::Server::Model::GameSession &gameSession) {
     // Inject data that already exists on the server
     gameSession.SetFleetId(m_fleetId);
@@ -282,12 +143,17 @@ void Aws::GameLift::Internal::GameLiftServerState::OnStartGameSession(Aws::GameL
         return;
     }
 
-    m_gameSessionId = gameSessionId;
+    {
+        std::lock_guard<std::mutex> lock(m_gameSessionIdMutex);
+        m_gameSessionId = gameSessionId;
+    }
 
     // Invoking OnStartGameSession callback if specified by the developer.
     if (m_onStartGameSession) {
-        std::thread activateGameSession(std::bind(m_onStartGameSession, gameSession));
-        activateGameSession.detach();
+        // Hand the session over rather than copying it into the task and again into the callback.
+        std::function<void(Aws::GameLift::Server::Model::GameSession)> onStartGameSession = m_onStartGameSession;
+        std::shared_ptr<Aws::GameLift::Server::Model::GameSession> session = std::make_shared<Aws::GameLift::Server::Model::GameSession>(std::move(gameSession));
+        GameLiftExecutor::GetInstance().Post(m_gameSessionCallbackStrand, [onStartGameSession, session]() { onStartGameSession(std::move(*session)); });
     }
 }
 
@@ -301,24 +167,26 @@ void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long termi
 
     // Invoking OnProcessTerminate callback if specified by the developer.
     if (m_onProcessTerminate) {
-        std::thread terminateProcess(std::bind(m_onProcessTerminate));
-        terminateProcess.detach();
+        GameLiftExecutor::GetInstance().Post(m_onProcessTerminate);
     } else {
         spdlog::info("OnProcessTerminate handler is not defined. Calling ProcessEnding() and Destroy()");
-        GenericOutcome processEndingResult = ProcessEnding();
-        GenericOutcome destroyResult = DestroyInstance();
-        if (processEndingResult.IsSuccess() && destroyResult.IsSuccess()) {
-            exit(0);
-        }
-        else {
-            if (!processEndingResult.IsSuccess()) {
-                spdlog::error("Failed to call ProcessEnding().");
+        // ProcessEnding() waits for a response that is read on the I/O thread we are called on.
+        GameLiftExecutor::GetInstance().Post([this]() {
+            GenericOutcome processEndingResult = ProcessEnding();
+            GenericOutcome destroyResult = DestroyInstance();
+            if (processEndingResult.IsSuccess() && destroyResult.IsSuccess()) {
+                exit(0);
             }
-            if (!destroyResult.IsSuccess()) {
-                spdlog::error("Failed to call Destroy().");
+            else {
+                if (!processEndingResult.IsSuccess()) {
+                    spdlog::error("Failed to call ProcessEnding().");
+                }
+                if (!destroyResult.IsSuccess()) {
+                    spdlog::error("Failed to call Destroy().");
+                }
+                exit(-1);
             }
-            exit(-1);
-        }
+        });
     }
 }
 
@@ -329,8 +197,10 @@ void Aws::GameLift::Internal::GameLiftServerState::OnUpdateGameSession(Aws::Game
 
     // Invoking OnUpdateGameSession callback if specified by the developer.
     if (m_onUpdateGameSession) {
-        std::thread updateGameSessionThread(std::bind(m_onUpdateGameSession, updateGameSession));
-        updateGameSessionThread.detach();
+        std::function<void(Aws::GameLift::Server::Model::UpdateGameSession)> onUpdateGameSession = m_onUpdateGameSession;
+        std::shared_ptr<Aws::GameLift::Server::Model::UpdateGameSession> update =
+            std::make_shared<Aws::GameLift::Server::Model::UpdateGameSession>(std::move(updateGameSession));
+        GameLiftExecutor::GetInstance().Post(m_gameSessionCallbackStrand, [onUpdateGameSession, update]() { onUpdateGameSession(std::move(*update)); });
     }
 }
 
@@ -341,7 +211,11 @@ void Aws::GameLift::Internal::GameLiftServerState::OnRefreshConnection(const std
     m_connectionEndpoint = refreshConnectionEndpoint;
     m_authToken = authToken;
     spdlog::info("Refreshing Connection to ConnectionEndpoint: {} for process {}...", m_connectionEndpoint, m_processId);
-    m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+    // Connect() waits for the new connection's open handshake, which is serviced by the I/O thread
+    // this message arrived on, so hand it to the connection thread.
+    DispatchReconnect([this, refreshConnectionEndpoint, authToken]() {
+        return m_webSocketClientManager->Connect(refreshConnectionEndpoint, authToken, m_processId, m_hostId, m_fleetId);
+    }, nullptr);
 }
 
 bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() { return !m_webSocketClientManager || !m_webSocketClientManager->IsConnected(); }
@@ -353,28 +227,24 @@ bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() {
 #endif
 Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
     : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_processReady(false), m_terminationTime(-1),
-      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckThread(nullptr), m_healthCheckInterrupted(false),
+      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr),
       m_createGameSessionCallback(new CreateGameSessionCallback(this)), m_describePlayerSessionsCallback(new DescribePlayerSessionsCallback()),
       m_getComputeCertificateCallback(new GetComputeCertificateCallback()), m_getFleetRoleCredentialsCallback(new GetFleetRoleCredentialsCallback()),
       m_terminateProcessCallback(new TerminateProcessCallback(this)), m_updateGameSessionCallback(new UpdateGameSessionCallback(this)),
-      m_startMatchBackfillCallback(new StartMatchBackfillCallback()), m_refreshConnectionCallback(new RefreshConnectionCallback(this)) {}
+      m_startMatchBackfillCallback(new StartMatchBackfillCallback()), m_refreshConnectionCallback(new RefreshConnectionCallback(this)),
+      m_heartbeatScheduler(nullptr) {}
 
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
 
 Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
+    WaitForAsyncCalls();
     m_processReady = false;
-    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
-        {
-            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-            m_healthCheckInterrupted = true;
-            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
-            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
-            // the thread will continue without waiting the full ~60 second interval.
-            m_healthCheckConditionVariable.notify_all();
-        }
-        m_healthCheckThread->join();
+    if (m_heartbeatScheduler) {
+        // Cancels the next beat now rather than when it was due, and waits out a heartbeat in flight.
+        m_heartbeatScheduler->Stop();
+        m_heartbeatScheduler.reset();
     }
 
     Aws::GameLift::Internal::GameLiftCommonState::SetInstance(nullptr);
@@ -397,9 +267,7 @@ Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
     m_webSocketClientWrapper = nullptr;
 }
 
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters) {
-    spdlog::info("Calling ProcessReady");
-
+void Aws::GameLift::Internal::GameLiftServerState::SetProcessCallbacks(const Aws::GameLift::Server::ProcessParameters &processParameters) {
     m_onStartGameSession = processParameters.getOnStartGameSession();
     m_startGameSessionState = processParameters.getStartGameSessionState();
     m_onUpdateGameSession = processParameters.getOnUpdateGameSession();
@@ -408,160 +276,28 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const
     m_processTerminateState = processParameters.getProcessTerminateState();
     m_onHealthCheck = processParameters.getOnHealthCheck();
     m_healthCheckState = processParameters.getHealthCheckState();
-
-    if (processParameters.getPort() < 0 || processParameters.getPort() > 65535) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Port number is invalid."));
-    }
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    const char* sdkToolNameEnvironmentVariable = std::getenv(ENV_VAR_SDK_TOOL_NAME);
-    const char* sdkToolVersionEnvironmentVariable = std::getenv(ENV_VAR_SDK_TOOL_VERSION);
-
-    std::string sdkToolName = sdkToolNameEnvironmentVariable == nullptr ? "" : sdkToolNameEnvironmentVariable;
-    std::string sdkToolVersion = sdkToolVersionEnvironmentVariable == nullptr ? "" : sdkToolVersionEnvironmentVariable;
-
-    Aws::GameLift::Internal::ActivateServerProcessRequest activateServerProcessRequest(Server::GetSdkVersion().GetResult(), Aws::GameLift::Internal::GameLiftServerState::LANGUAGE,
-                                                                        sdkToolName, sdkToolVersion,
-                                                                        processParameters.getPort(), processParameters.getLogParameters());
-    Aws::GameLift::Internal::Message &request = activateServerProcessRequest;
-
-    // SendSocketMessageWithRetries makes sync call
-    GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-
-    if (result.IsSuccess()) {
-        spdlog::info("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting m_healthCheckThread().");
-        m_processReady = true;
-        m_healthCheckThread = std::unique_ptr<std::thread>(new std::thread([this] { HealthCheck(); }));
-    } else {
-        spdlog::info("Error while executing ActivateServerProcess. See the root cause error for more information.");
-    }
-
-    return result;
 }
 
-void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
-    spdlog::info("Calling ReportHealth");
-    std::future<bool> future(std::async([]() { return true; }));
-    if (m_onHealthCheck) {
-        future = std::async(std::launch::async, m_onHealthCheck, m_healthCheckState);
-    }
-
-    std::chrono::system_clock::time_point timeoutSeconds = std::chrono::system_clock::now() + std::chrono::milliseconds(HEALTHCHECK_TIMEOUT_MILLIS);
-    bool health = false;
-
-    // wait_until blocks until timeoutSeconds has been reached or the result becomes available
-    if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
-        health = future.get();
-        spdlog::info("Received Health Response: {} from Server Process: {}", health, m_processId);
-    } else {
-        spdlog::warn("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
-    }
-
-    Aws::GameLift::Internal::HeartbeatServerProcessRequest msg = Aws::GameLift::Internal::HeartbeatServerProcessRequest().WithHealthy(health);
-    if (m_webSocketClientManager || m_webSocketClientWrapper) {
-        spdlog::info("Trying to report process health as {} for process {}", health, m_processId);
-        auto outcome = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(msg);
-        if (!outcome.IsSuccess()) {
-            spdlog::error("Error reporting process health for process {}.", m_processId);
-        }
-    } else {
-        spdlog::error("Tried to report process health for process {} with no active connection", m_processId);
+void Aws::GameLift::Internal::GameLiftServerState::StartHealthCheck() {
+    std::function<bool(void *)> onHealthCheck = m_onHealthCheck;
+    void *healthCheckState = m_healthCheckState;
+    HeartbeatScheduler::HealthProbe probe = nullptr;
+    if (onHealthCheck) {
+        probe = [onHealthCheck, healthCheckState]() { return onHealthCheck(healthCheckState); };
     }
+    StartHeartbeatScheduler(probe);
 }
 
-::GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessEnding() {
-    m_processReady = false;
-
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    Aws::GameLift::Internal::TerminateServerProcessRequest terminateServerProcessRequest;
-    Aws::GameLift::Internal::Message &request = terminateServerProcessRequest;
-    GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-
-    return result;
+const char * Aws::GameLift::Internal::GameLiftServerState::GetGameSessionId() {
+    // The ID can change on the I/O thread at any time, so hand out a copy that stays put until this
+    // thread asks again.
+    thread_local std::string gameSessionId;
+    gameSessionId = CopyGameSessionId();
+    return gameSessionId.c_str();
 }
 
-const char * Aws::GameLift::Internal::GameLiftServerState::GetGameSessionId() { return m_gameSessionId.c_str(); }
-
 long Aws::GameLift::Internal::GameLiftServerState::GetTerminationTime() { return m_terminationTime; }
 
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ActivateGameSession() {
-    if (!m_processReady) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
-    }
-
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    Aws::GameLift::Internal::ActivateGameSessionRequest activateGameSessionRequest(m_gameSessionId);
-    Aws::GameLift::Internal::Message &request = activateGameSessionRequest;
-    GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-
-    return result;
-}
-
-GenericOutcome
-Aws::GameLift::Internal::GameLiftServerState::UpdatePlayerSessionCreationPolicy(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy) {
-    std::string newPlayerSessionPolicyInString =
-        Aws::GameLift::Server::Model::PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy);
-
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    if (m_gameSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
-    }
-
-    Aws::GameLift::Internal::UpdatePlayerSessionCreationPolicyRequest updatePlayerSessionCreationPolicyRequest(
-        m_gameSessionId, PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy));
-    Aws::GameLift::Internal::Message &request = updatePlayerSessionCreationPolicyRequest;
-    GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-
-    return result;
-}
-
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSession(const std::string &playerSessionId) {
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    if (m_gameSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
-    }
-
-    if (playerSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
-    }
-
-    AcceptPlayerSessionRequest request = AcceptPlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
-
-    return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-}
-
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSession(const std::string &playerSessionId) {
-    if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
-    }
-
-    if (m_gameSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
-    }
-
-    if (playerSessionId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
-    }
-
-    RemovePlayerSessionRequest request = RemovePlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
-
-    return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-}
-
 std::shared_ptr<Aws::GameLift::Internal::IWebSocketClientWrapper> Aws::GameLift::Internal::GameLiftServerState::GetWebSocketClientWrapper() const { return m_webSocketClientWrapper; }
 
 Aws::GameLift::Internal::InitSDKOutcome Aws::GameLift::Internal::GameLiftServerState::ConstructInternal(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper) {
@@ -590,12 +326,19 @@ void Aws::GameLift::Internal::GameLiftServerState::OnStartGameSession(Aws::GameL
         return;
     }
 
-    m_gameSessionId = gameSessionId;
+    {
+        std::lock_guard<std::mutex> lock(m_gameSessionIdMutex);
+        m_gameSessionId = gameSessionId;
+    }
 
     // Invoking OnStartGameSession callback if specified by the developer.
     if (m_onStartGameSession) {
-        std::thread activateGameSession(std::bind(m_onStartGameSession, gameSession, m_startGameSessionState));
-        activateGameSession.detach();
+        // Hand the session over rather than copying it into the task and again into the callback.
+        std::function<void(Aws::GameLift::Server::Model::GameSession, void *)> onStartGameSession = m_onStartGameSession;
+        void *startGameSessionState = m_startGameSessionState;
+        std::shared_ptr<Aws::GameLift::Server::Model::GameSession> session = std::make_shared<Aws::GameLift::Server::Model::GameSession>(std::move(gameSession));
+        GameLiftExecutor::GetInstance().Post(m_gameSessionCallbackStrand,
+                                             [onStartGameSession, session, startGameSessionState]() { onStartGameSession(std::move(*session), startGameSessionState); });
     }
 }
 
@@ -606,8 +349,12 @@ void Aws::GameLift::Internal::GameLiftServerState::OnUpdateGameSession(Aws::Game
 
     // Invoking OnUpdateGameSession callback if specified by the developer.
     if (m_onUpdateGameSession) {
-        std::thread updateGameSessionThread(std::bind(m_onUpdateGameSession, updateGameSession, m_updateGameSessionState));
-        updateGameSessionThread.detach();
+        std::function<void(Aws::GameLift::Server::Model::UpdateGameSession, void *)> onUpdateGameSession = m_onUpdateGameSession;
+        void *updateGameSessionState = m_updateGameSessionState;
+        std::shared_ptr<Aws::GameLift::Server::Model::UpdateGameSession> update =
+            std::make_shared<Aws::GameLift::Server::Model::UpdateGameSession>(std::move(updateGameSession));
+        GameLiftExecutor::GetInstance().Post(m_gameSessionCallbackStrand,
+                                             [onUpdateGameSession, update, updateGameSessionState]() { onUpdateGameSession(std::move(*update), updateGameSessionState); });
     }
 }
 
@@ -621,24 +368,26 @@ void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long termi
 
     // Invoking onProcessTerminate callback if specified by the developer.
     if (m_onProcessTerminate) {
-        std::thread terminateProcess(std::bind(m_onProcessTerminate, m_processTerminateState));
-        terminateProcess.detach();
+        GameLiftExecutor::GetInstance().Post(std::bind(m_onProcessTerminate, m_processTerminateState));
     } else {
         spdlog::info("OnProcessTerminate handler is not defined. Calling ProcessEnding() and Destroy()");
-        GenericOutcome processEndingResult = ProcessEnding();
-        GenericOutcome destroyResult = DestroyInstance();
-        if (processEndingResult.IsSuccess() && destroyResult.IsSuccess()) {
-            exit(0);
-        }
-        else {
-            if (!processEndingResult.IsSuccess()) {
-                spdlog::error("Failed to call ProcessEnding().");
+        // ProcessEnding() waits for a response that is read on the I/O thread we are called on.
+        GameLiftExecutor::GetInstance().Post([this]() {
+            GenericOutcome processEndingResult = ProcessEnding();
+            GenericOutcome destroyResult = DestroyInstance();
+            if (processEndingResult.IsSuccess() && destroyResult.IsSuccess()) {
+                exit(0);
             }
-            if (!destroyResult.IsSuccess()) {
-                spdlog::error("Failed to call Destroy().");
+            else {
+                if (!processEndingResult.IsSuccess()) {
+                    spdlog::error("Failed to call ProcessEnding().");
+                }
+                if (!destroyResult.IsSuccess()) {
+                    spdlog::error("Failed to call Destroy().");
+                }
+                exit(-1);
             }
-            exit(-1);
-        }
+        });
     }
 }
 
@@ -649,7 +398,11 @@ void Aws::GameLift::Internal::GameLiftServerState::OnRefreshConnection(const std
     m_connectionEndpoint = refreshConnectionEndpoint;
     m_authToken = authToken;
     spdlog::info("Refreshing Connection to ConnectionEndpoint: {} for process {}...", m_connectionEndpoint, m_processId);
-    m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+    // Connect() waits for the new connection's open handshake, which is serviced by the I/O thread
+    // this message arrived on, so hand it to the connection thread.
+    DispatchReconnect([this, refreshConnectionEndpoint, authToken]() {
+        return m_webSocketClientManager->Connect(refreshConnectionEndpoint, authToken, m_processId, m_hostId, m_fleetId);
+    }, nullptr);
 }
 
 bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() { return !m_webSocketClientManager || !m_webSocketClientManager->IsConnected(); }
@@ -797,7 +550,11 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
 
 void Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks() {
     // Setup
-    m_webSocketClientManager = new Aws::GameLift::Internal::GameLiftWebSocketClientManager(m_webSocketClientWrapper);
+    delete m_webSocketClientManager;
+    if (!m_requestWindow) {
+        m_requestWindow = std::make_shared<RequestWindow>(GetMaxInFlightRequests());
+    }
+    m_webSocketClientManager = new Aws::GameLift::Internal::GameLiftWebSocketClientManager(m_webSocketClientWrapper, m_requestWindow);
 
     // Setup CreateGameSession callback
     spdlog::info("Setting Up WebSocket With default callbacks");
@@ -829,63 +586,260 @@ void Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks() {
         std::bind(&RefreshConnectionCallback::OnRefreshConnection, m_refreshConnectionCallback.get(), std::placeholders::_1));
 }
 
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(Message &message) {
-    spdlog::debug("Trying to send socket message for process: {}...", m_processId);
-    GenericOutcome outcome;
-    int resendFailureCount = 0;
-    const int maxFailuresBeforeReconnect = 2;
-
-    // Delegate to the websocketClientManager to send the request and retry if possible
-    const std::function<bool(void)> &retriable = [&] {
-        outcome = m_webSocketClientManager->SendSocketMessage(message);
-        if (outcome.IsSuccess()) {
-            spdlog::debug("Successfully send message for process: {}", m_processId);
-            return true;
-        }
-        else if (outcome.GetError().GetErrorType() == GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE) {
-            resendFailureCount++;
-            if (resendFailureCount >= maxFailuresBeforeReconnect) {
-                spdlog::warn("Max sending message failure threshold reached for process: {}. Attempting to reconnect...", m_processId);
-                m_webSocketClientWrapper->Disconnect();
-
-                spdlog::info("Attempting to create a new WebSocket connections for process: {}...", m_processId);
-                // Create a completely new webSocketClientWrapper
-                std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
-                m_webSocketClientWrapper = std::make_shared<Internal::WebSocketppClientWrapper>(wsClientPointer);
-
-                spdlog::info("Re-establish Networking...");
-                // Re-establish network with new webSocketClientWrapper
-                Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks();
-                auto networkOutcome = m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
-                if (networkOutcome.IsSuccess()) {
-                    spdlog::info("Reconnected successfully. Retrying message sending...");
-                    resendFailureCount = 0;
-                    return false; // Force another retry sending message after successful connection
-                } else {
-                    spdlog::error("Reconnection failed. Aborting retries.");
-                    return true; // Abort retry if connection fails
-                }
-            }
-            return false; // Continue retrying if not reaching the threshold
-        }
-        else {
-            return true; // Not retry sending message for unexpected errors aside from WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE
-        }
-    };
+std::string Aws::GameLift::Internal::GameLiftServerState::CopyGameSessionId() const {
+    std::lock_guard<std::mutex> lock(m_gameSessionIdMutex);
+    return m_gameSessionId;
+}
 
+struct Aws::GameLift::Internal::GameLiftServerState::RetryingSend {
+    std::shared_ptr<Message> message;
+    IWebSocketClientWrapper::ResponseCallback onResponse;
     // Jittered retry required because many requests can cause buffer to fill.
     // If retries all happpen in sync, it can cause potential delays in recovery.
     JitteredGeometricBackoffRetryStrategy retryStrategy;
-    RetryingCallable callable = RetryingCallable::Builder().WithRetryStrategy(&retryStrategy).WithCallable(retriable).Build();
+    int attempts = 0;
+    int resendFailureCount = 0;
+};
 
-    callable.call();
+GenericOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(Message &message) {
+    // The caller's message outlives the wait below, so it is borrowed rather than copied.
+    std::shared_ptr<Message> borrowedMessage(&message, [](Message *) {});
+    auto response = std::make_shared<std::promise<GenericOutcome>>();
+    std::future<GenericOutcome> responseFuture = response->get_future();
+    SendSocketMessageWithRetriesAsync(borrowedMessage, [response](const GenericOutcome &outcome) { response->set_value(outcome); });
+    return responseFuture.get();
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetriesAsync(std::shared_ptr<Message> message,
+                                                                                     const IWebSocketClientWrapper::ResponseCallback &onResponse) {
+    spdlog::debug("Trying to send socket message for process: {}...", m_processId);
+    BeginAsyncCall();
+    std::shared_ptr<RetryingSend> send = std::make_shared<RetryingSend>();
+    send->message = std::move(message);
+    send->onResponse = onResponse;
+    SendAttempt(send);
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::SendAttempt(const std::shared_ptr<RetryingSend> &send) {
+    // Delegate to the websocketClientManager to send the request
+    m_webSocketClientManager->SendSocketMessageAsync(*send->message, [this, send](const GenericOutcome &outcome) { OnSendAttempt(send, outcome); });
+}
 
-    if (resendFailureCount > 0 && !outcome.IsSuccess()) {
+void Aws::GameLift::Internal::GameLiftServerState::OnSendAttempt(const std::shared_ptr<RetryingSend> &send, const GenericOutcome &outcome) {
+    const int attempt = send->attempts++;
+    if (outcome.IsSuccess()) {
+        spdlog::debug("Successfully send message for process: {}", m_processId);
+        FinishSend(send, outcome);
+        return;
+    }
+    if (outcome.GetError().GetErrorType() != GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE) {
+        // Not retry sending message for unexpected errors aside from WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE
+        FinishSend(send, outcome);
+        return;
+    }
+
+    send->resendFailureCount++;
+    if (send->resendFailureCount < MAX_SEND_FAILURES_BEFORE_RECONNECT) {
+        RetrySend(send, attempt, outcome);
+        return;
+    }
+
+    spdlog::warn("Max sending message failure threshold reached for process: {}. Attempting to reconnect...", m_processId);
+    // Reconnect in place: the client, its handlers and the I/O thread are kept and only the
+    // connection is replaced. The unresponsive connection is closed once the new one is open, the
+    // same way a RefreshConnection is handled.
+    spdlog::info("Re-establish Networking...");
+    DispatchReconnect([this]() { return m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId); },
+                      [this, send, attempt, outcome](const GenericOutcome &networkOutcome) {
+                          if (networkOutcome.IsSuccess()) {
+                              spdlog::info("Reconnected successfully. Retrying message sending...");
+                              send->resendFailureCount = 0;
+                              RetrySend(send, attempt, outcome);
+                          } else {
+                              spdlog::error("Reconnection failed. Aborting retries.");
+                              FinishSend(send, outcome);
+                          }
+                      });
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::RetrySend(const std::shared_ptr<RetryingSend> &send, int failedAttempt, const GenericOutcome &outcome) {
+    if (send->attempts >= send->retryStrategy.GetMaxRetries()) {
+        FinishSend(send, outcome);
+        return;
+    }
+
+    const int delayMillis = send->retryStrategy.GetRetryDelayMillis(failedAttempt);
+    spdlog::warn("Sending Message Failed. Retrying in {} milliseconds...", delayMillis);
+    // The executor outlives every timer, so the wait always completes and the send always finishes.
+    auto timer = std::make_shared<asio::steady_timer>(GameLiftExecutor::GetInstance().GetIoContext(), std::chrono::milliseconds(delayMillis));
+    timer->async_wait([this, send, timer](const std::error_code &) { SendAttempt(send); });
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::FinishSend(const std::shared_ptr<RetryingSend> &send, GenericOutcome outcome) {
+    if (send->resendFailureCount > 0 && !outcome.IsSuccess()) {
         spdlog::error("Error sending socket message");
         outcome = GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE);
     }
+    send->onResponse(outcome);
+    EndAsyncCall();
+}
+
+GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters) {
+    return ProcessReadyAsync(processParameters, nullptr).get();
+}
+
+GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessEnding() { return ProcessEndingAsync(nullptr).get(); }
+
+GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ActivateGameSession() { return ActivateGameSessionAsync(nullptr).get(); }
+
+GenericOutcome
+Aws::GameLift::Internal::GameLiftServerState::UpdatePlayerSessionCreationPolicy(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy) {
+    return UpdatePlayerSessionCreationPolicyAsync(newPlayerSessionPolicy, nullptr).get();
+}
+
+GenericOutcome Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSession(const std::string &playerSessionId) {
+    return AcceptPlayerSessionAsync(playerSessionId, nullptr).get();
+}
+
+GenericOutcome Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSession(const std::string &playerSessionId) {
+    return RemovePlayerSessionAsync(playerSessionId, nullptr).get();
+}
+
+DescribePlayerSessionsOutcome
+Aws::GameLift::Internal::GameLiftServerState::DescribePlayerSessions(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest) {
+    return DescribePlayerSessionsAsync(describePlayerSessionsRequest, nullptr).get();
+}
+
+StartMatchBackfillOutcome
+Aws::GameLift::Internal::GameLiftServerState::StartMatchBackfill(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest) {
+    return StartMatchBackfillAsync(startMatchBackfillRequest, nullptr).get();
+}
+
+GenericOutcome Aws::GameLift::Internal::GameLiftServerState::StopMatchBackfill(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &stopMatchBackfillRequest) {
+    return StopMatchBackfillAsync(stopMatchBackfillRequest, nullptr).get();
+}
+
+GetComputeCertificateOutcome Aws::GameLift::Internal::GameLiftServerState::GetComputeCertificate() { return GetComputeCertificateAsync(nullptr).get(); }
+
+GetFleetRoleCredentialsOutcome
+Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request) {
+    return GetFleetRoleCredentialsAsync(request, nullptr).get();
+}
+
+GenericOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::ProcessReadyAsync(const Aws::GameLift::Server::ProcessParameters &processParameters,
+                                                                                       const GenericOutcomeCallback &callback) {
+    spdlog::info("Calling ProcessReady");
+
+    SetProcessCallbacks(processParameters);
+
+    if (processParameters.getPort() < 0 || processParameters.getPort() > 65535) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Port number is invalid.")), callback);
+    }
+    if (AssertNetworkInitialized()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
+    }
+
+    const char* sdkToolNameEnvironmentVariable = std::getenv(ENV_VAR_SDK_TOOL_NAME);
+    const char* sdkToolVersionEnvironmentVariable = std::getenv(ENV_VAR_SDK_TOOL_VERSION);
+
+    std::string sdkToolName = sdkToolNameEnvironmentVariable == nullptr ? "" : sdkToolNameEnvironmentVariable;
+    std::string sdkToolVersion = sdkToolVersionEnvironmentVariable == nullptr ? "" : sdkToolVersionEnvironmentVariable;
 
-    return outcome;
+    std::shared_ptr<Message> request = std::make_shared<Aws::GameLift::Internal::ActivateServerProcessRequest>(
+        Server::GetSdkVersion().GetResult(), Aws::GameLift::Internal::GameLiftServerState::LANGUAGE, sdkToolName, sdkToolVersion, processParameters.getPort(),
+        processParameters.getLogParameters());
+
+    return SendAsync<GenericOutcome>(request, [this](const GenericOutcome &result) {
+        if (result.IsSuccess()) {
+            spdlog::info("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting health checks.");
+            m_processReady = true;
+            StartHealthCheck();
+        } else {
+            spdlog::info("Error while executing ActivateServerProcess. See the root cause error for more information.");
+        }
+        return result;
+    }, callback);
+}
+
+GenericOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::ProcessEndingAsync(const GenericOutcomeCallback &callback) {
+    m_processReady = false;
+    if (m_heartbeatScheduler) {
+        m_heartbeatScheduler->Stop();
+    }
+
+    if (AssertNetworkInitialized()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
+    }
+
+    return SendAsync<GenericOutcome>(std::make_shared<Aws::GameLift::Internal::TerminateServerProcessRequest>(), ReturnResponse, callback);
+}
+
+GenericOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::ActivateGameSessionAsync(const GenericOutcomeCallback &callback) {
+    if (!m_processReady) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), callback);
+    }
+
+    if (AssertNetworkInitialized()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
+    }
+
+    return SendAsync<GenericOutcome>(std::make_shared<Aws::GameLift::Internal::ActivateGameSessionRequest>(CopyGameSessionId()), ReturnResponse, callback);
+}
+
+GenericOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::UpdatePlayerSessionCreationPolicyAsync(PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                                                                            const GenericOutcomeCallback &callback) {
+    if (AssertNetworkInitialized()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
+    }
+
+    std::string gameSessionId = CopyGameSessionId();
+    if (gameSessionId.empty()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET)), callback);
+    }
+
+    std::shared_ptr<Message> request = std::make_shared<Aws::GameLift::Internal::UpdatePlayerSessionCreationPolicyRequest>(
+        gameSessionId, PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy));
+    return SendAsync<GenericOutcome>(request, ReturnResponse, callback);
+}
+
+GenericOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSessionAsync(const std::string &playerSessionId,
+                                                                                              const GenericOutcomeCallback &callback) {
+    if (AssertNetworkInitialized()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
+    }
+
+    std::string gameSessionId = CopyGameSessionId();
+    if (gameSessionId.empty()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET)), callback);
+    }
+
+    if (playerSessionId.empty()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty.")), callback);
+    }
+
+    std::shared_ptr<Message> request =
+        std::make_shared<AcceptPlayerSessionRequest>(AcceptPlayerSessionRequest().WithGameSessionId(gameSessionId).WithPlayerSessionId(playerSessionId));
+    return SendAsync<GenericOutcome>(request, ReturnResponse, callback);
+}
+
+GenericOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSessionAsync(const std::string &playerSessionId,
+                                                                                              const GenericOutcomeCallback &callback) {
+    if (AssertNetworkInitialized()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
+    }
+
+    std::string gameSessionId = CopyGameSessionId();
+    if (gameSessionId.empty()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET)), callback);
+    }
+
+    if (playerSessionId.empty()) {
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty.")), callback);
+    }
+
+    std::shared_ptr<Message> request =
+        std::make_shared<RemovePlayerSessionRequest>(RemovePlayerSessionRequest().WithGameSessionId(gameSessionId).WithPlayerSessionId(playerSessionId));
+    return SendAsync<GenericOutcome>(request, ReturnResponse, callback);
 }
 
 #if defined(__GNUC__) || defined(__clang__)
@@ -893,114 +847,129 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWi
 #pragma GCC diagnostic ignored "-Wdelete-non-abstract-non-virtual-dtor"
 #endif
 
-DescribePlayerSessionsOutcome
-Aws::GameLift::Internal::GameLiftServerState::DescribePlayerSessions(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest) {
+DescribePlayerSessionsOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::DescribePlayerSessionsAsync(
+    const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest, const DescribePlayerSessionsOutcomeCallback &callback) {
     if (AssertNetworkInitialized()) {
-        return DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        return CompletedAsync(DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
     }
 
-    Aws::GameLift::Internal::WebSocketDescribePlayerSessionsRequest request = Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(describePlayerSessionsRequest);
-    GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-    if (rawResponse.IsSuccess()) {
-        WebSocketDescribePlayerSessionsResponse *webSocketResponse = static_cast<WebSocketDescribePlayerSessionsResponse *>(rawResponse.GetResult());
-        DescribePlayerSessionsResult result = Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(webSocketResponse);
-        delete webSocketResponse;
+    std::shared_ptr<Message> request = std::make_shared<Aws::GameLift::Internal::WebSocketDescribePlayerSessionsRequest>(
+        Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(describePlayerSessionsRequest));
+    return SendAsync<DescribePlayerSessionsOutcome>(request, [](const GenericOutcome &rawResponse) -> DescribePlayerSessionsOutcome {
+        if (rawResponse.IsSuccess()) {
+            WebSocketDescribePlayerSessionsResponse *webSocketResponse = static_cast<WebSocketDescribePlayerSessionsResponse *>(rawResponse.GetResult());
+            DescribePlayerSessionsResult result = Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(webSocketResponse);
+            delete webSocketResponse;
 
-        return DescribePlayerSessionsOutcome(result);
-    } else {
-        return DescribePlayerSessionsOutcome(rawResponse.GetError());
-    }
+            return DescribePlayerSessionsOutcome(result);
+        } else {
+            return DescribePlayerSessionsOutcome(rawResponse.GetError());
+        }
+    }, callback);
 }
 
-StartMatchBackfillOutcome
-Aws::GameLift::Internal::GameLiftServerState::StartMatchBackfill(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest) {
+StartMatchBackfillOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::StartMatchBackfillAsync(
+    const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest, const StartMatchBackfillOutcomeCallback &callback) {
     if (Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized()) {
-        return StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        return CompletedAsync(StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
     }
 
 #ifdef GAMELIFT_USE_STD
     if (startMatchBackfillRequest.GetPlayers().empty()) {
-        return StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Players cannot be empty."));
+        return CompletedAsync(StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Players cannot be empty.")), callback);
     }
 #else
     int countOfPlayers;
     startMatchBackfillRequest.GetPlayers(countOfPlayers);
     if (countOfPlayers == 0) {
-        return StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Players cannot be empty."));
+        return CompletedAsync(StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Players cannot be empty.")), callback);
     }
 #endif
 
-    Aws::GameLift::Internal::WebSocketStartMatchBackfillRequest request = Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(startMatchBackfillRequest);
-    GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-    if (rawResponse.IsSuccess()) {
-        WebSocketStartMatchBackfillResponse *webSocketResponse = static_cast<WebSocketStartMatchBackfillResponse *>(rawResponse.GetResult());
-        StartMatchBackfillResult result = Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(webSocketResponse);
-        delete webSocketResponse;
-
-        return StartMatchBackfillOutcome(result);
-    } else {
-        return StartMatchBackfillOutcome(rawResponse.GetError());
-    }
+    // The message may be serialized again after this returns (window waits, retries, re-sends after a
+    // reconnect), and the caller's request may be a temporary, so the message keeps its own copy.
+    std::shared_ptr<const Aws::GameLift::Server::Model::StartMatchBackfillRequest> ownedRequest =
+        std::make_shared<const Aws::GameLift::Server::Model::StartMatchBackfillRequest>(startMatchBackfillRequest);
+    std::shared_ptr<Message> request = std::make_shared<Aws::GameLift::Internal::WebSocketStartMatchBackfillRequest>(
+        Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(ownedRequest));
+    return SendAsync<StartMatchBackfillOutcome>(request, [](const GenericOutcome &rawResponse) -> StartMatchBackfillOutcome {
+        if (rawResponse.IsSuccess()) {
+            WebSocketStartMatchBackfillResponse *webSocketResponse = static_cast<WebSocketStartMatchBackfillResponse *>(rawResponse.GetResult());
+            StartMatchBackfillResult result = Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(webSocketResponse);
+            delete webSocketResponse;
+
+            return StartMatchBackfillOutcome(result);
+        } else {
+            return StartMatchBackfillOutcome(rawResponse.GetError());
+        }
+    }, callback);
 }
 
-GenericOutcome Aws::GameLift::Internal::GameLiftServerState::StopMatchBackfill(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &stopMatchBackfillRequest) {
+GenericOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &stopMatchBackfillRequest,
+                                                                                            const GenericOutcomeCallback &callback) {
     if (AssertNetworkInitialized()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        return CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
     }
 
-    Aws::GameLift::Internal::WebSocketStopMatchBackfillRequest request = Aws::GameLift::Internal::WebSocketStopMatchBackfillRequest()
-                                                              .WithTicketId(stopMatchBackfillRequest.GetTicketId())
-                                                              .WithGameSessionArn(stopMatchBackfillRequest.GetGameSessionArn())
-                                                              .WithMatchmakingConfigurationArn(stopMatchBackfillRequest.GetMatchmakingConfigurationArn());
-    GenericOutcome outcome = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-    if (!outcome.IsSuccess()) {
-        spdlog::error("Error calling StopMatchBackfill.");
-    }
-    return outcome;
+    std::shared_ptr<Message> request = std::make_shared<Aws::GameLift::Internal::WebSocketStopMatchBackfillRequest>(
+        Aws::GameLift::Internal::WebSocketStopMatchBackfillRequest()
+            .WithTicketId(stopMatchBackfillRequest.GetTicketId())
+            .WithGameSessionArn(stopMatchBackfillRequest.GetGameSessionArn())
+            .WithMatchmakingConfigurationArn(stopMatchBackfillRequest.GetMatchmakingConfigurationArn()));
+    return SendAsync<GenericOutcome>(request, [](const GenericOutcome &outcome) {
+        if (!outcome.IsSuccess()) {
+            spdlog::error("Error calling StopMatchBackfill.");
+        }
+        return outcome;
+    }, callback);
 }
 
-GetComputeCertificateOutcome Aws::GameLift::Internal::GameLiftServerState::GetComputeCertificate() {
+GetComputeCertificateOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::GetComputeCertificateAsync(const GetComputeCertificateOutcomeCallback &callback) {
     if (AssertNetworkInitialized()) {
-        return GetComputeCertificateOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        return CompletedAsync(GetComputeCertificateOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
     }
 
-    WebSocketGetComputeCertificateRequest request;
-    GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-    if (rawResponse.IsSuccess()) {
-        WebSocketGetComputeCertificateResponse *webSocketResponse = static_cast<WebSocketGetComputeCertificateResponse *>(rawResponse.GetResult());
-        GetComputeCertificateResult result = GetComputeCertificateResult()
-                                                 .WithCertificatePath(webSocketResponse->GetCertificatePath().c_str())
-                                                 .WithComputeName(webSocketResponse->GetComputeName().c_str());
-        delete webSocketResponse;
+    return SendAsync<GetComputeCertificateOutcome>(std::make_shared<WebSocketGetComputeCertificateRequest>(),
+                                                   [](const GenericOutcome &rawResponse) -> GetComputeCertificateOutcome {
+        if (rawResponse.IsSuccess()) {
+            WebSocketGetComputeCertificateResponse *webSocketResponse = static_cast<WebSocketGetComputeCertificateResponse *>(rawResponse.GetResult());
+            GetComputeCertificateResult result = GetComputeCertificateResult()
+                                                     .WithCertificatePath(webSocketResponse->GetCertificatePath().c_str())
+                                                     .WithComputeName(webSocketResponse->GetComputeName().c_str());
+            delete webSocketResponse;
 
-        return GetComputeCertificateOutcome(result);
-    } else {
-        return GetComputeCertificateOutcome(rawResponse.GetError());
-    }
+            return GetComputeCertificateOutcome(result);
+        } else {
+            return GetComputeCertificateOutcome(rawResponse.GetError());
+        }
+    }, callback);
 }
 
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
 
-GetFleetRoleCredentialsOutcome
-Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request) {
+GetFleetRoleCredentialsOutcomeCallable Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentialsAsync(
+    const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request, const GetFleetRoleCredentialsOutcomeCallback &callback) {
     if (AssertNetworkInitialized()) {
-        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        return CompletedAsync(GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)), callback);
     }
 
     // If we've decided we're not on managed EC2 or managed containers, fail without making an APIGW call
     if (!m_onManagedEC2OrContainers) {
-        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION, 
-            "Fleet role credentials not available for Anywhere fleet."));
+        return CompletedAsync(GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION,
+            "Fleet role credentials not available for Anywhere fleet.")), callback);
     }
 
-    auto webSocketRequest = Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(request);
+    std::shared_ptr<WebSocketGetFleetRoleCredentialsRequest> webSocketRequest =
+        std::make_shared<WebSocketGetFleetRoleCredentialsRequest>(Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(request));
+    const std::string roleArn = webSocketRequest->GetRoleArn();
 
     // Check if we're cached credentials recently that still has at least 15 minutes before
     // expiration
-    if (m_instanceRoleResultCache.find(webSocketRequest.GetRoleArn()) != m_instanceRoleResultCache.end()) {
-        auto previousResult = m_instanceRoleResultCache[webSocketRequest.GetRoleArn()];
+    std::unique_lock<std::mutex> cacheLock(m_instanceRoleResultCacheMutex);
+    if (m_instanceRoleResultCache.find(roleArn) != m_instanceRoleResultCache.end()) {
+        auto previousResult = m_instanceRoleResultCache[roleArn];
 #ifdef GAMELIFT_USE_STD
         std::tm expiration = previousResult.GetExpiration();
 #ifdef WIN32
@@ -1014,43 +983,111 @@ Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws:
         time_t currentTime = time(nullptr);
 
         if ((previousResultExpiration - INSTANCE_ROLE_CREDENTIAL_TTL_MIN) > currentTime) {
-            return GetFleetRoleCredentialsOutcome(previousResult);
+            cacheLock.unlock();
+            return CompletedAsync(GetFleetRoleCredentialsOutcome(previousResult), callback);
         }
 
-        m_instanceRoleResultCache.erase(webSocketRequest.GetRoleArn());
+        m_instanceRoleResultCache.erase(roleArn);
     }
+    cacheLock.unlock();
 
-    if (webSocketRequest.GetRoleSessionName().empty()) {
+    if (webSocketRequest->GetRoleSessionName().empty()) {
         std::string generatedRoleSessionName = m_fleetId + "-" + m_hostId;
         if (generatedRoleSessionName.length() > MAX_ROLE_SESSION_NAME_LENGTH) {
             generatedRoleSessionName = generatedRoleSessionName.substr(0, MAX_ROLE_SESSION_NAME_LENGTH);
         }
-        webSocketRequest.SetRoleSessionName(generatedRoleSessionName);
+        webSocketRequest->SetRoleSessionName(generatedRoleSessionName);
     }
 
-    if (webSocketRequest.GetRoleSessionName().length() > MAX_ROLE_SESSION_NAME_LENGTH) {
-        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION,
-            "GetFleetRoleCredentials failed; the role session name is too long. Please check role arn or session name and try again."));
+    if (webSocketRequest->GetRoleSessionName().length() > MAX_ROLE_SESSION_NAME_LENGTH) {
+        return CompletedAsync(GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION,
+            "GetFleetRoleCredentials failed; the role session name is too long. Please check role arn or session name and try again.")), callback);
     }
 
-    auto rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(webSocketRequest);
-    if (!rawResponse.IsSuccess()) {
-        return GetFleetRoleCredentialsOutcome(rawResponse.GetError());
+    return SendAsync<GetFleetRoleCredentialsOutcome>(webSocketRequest, [this, roleArn](const GenericOutcome &rawResponse) -> GetFleetRoleCredentialsOutcome {
+        if (!rawResponse.IsSuccess()) {
+            return GetFleetRoleCredentialsOutcome(rawResponse.GetError());
+        }
+
+        std::unique_ptr<WebSocketGetFleetRoleCredentialsResponse> webSocketResponse(
+            static_cast<WebSocketGetFleetRoleCredentialsResponse *>(rawResponse.GetResult()));
+
+        // If we get a success response from APIGW with empty fields we're not on managed EC2 or managed containers.
+        if (webSocketResponse->GetAccessKeyId().empty()) {
+            m_onManagedEC2OrContainers = false;
+            return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION,
+                "Fleet role credentials not available for Anywhere fleet."));
+        }
+
+        auto result = Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(webSocketResponse.get());
+        {
+            std::lock_guard<std::mutex> lock(m_instanceRoleResultCacheMutex);
+            m_instanceRoleResultCache[roleArn] = result;
+        }
+        return GetFleetRoleCredentialsOutcome(result);
+    }, callback);
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::DispatchReconnect(std::function<GenericOutcome()> connect, IWebSocketClientWrapper::ResponseCallback onConnected) {
+    BeginAsyncCall();
+    GameLiftExecutor::GetInstance().PostConnectionTask([this, connect, onConnected]() {
+        GenericOutcome outcome = connect();
+        if (onConnected) {
+            onConnected(outcome);
+        }
+        EndAsyncCall();
+    });
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::BeginAsyncCall() {
+    std::lock_guard<std::mutex> lock(m_asyncCallMutex);
+    m_asyncCallsInFlight++;
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::EndAsyncCall() {
+    // Notified under the lock: the destructor may be waiting, and frees the condition variable as
+    // soon as it wakes.
+    std::lock_guard<std::mutex> lock(m_asyncCallMutex);
+    if (--m_asyncCallsInFlight == 0) {
+        m_asyncCallConditionVariable.notify_all();
     }
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::WaitForAsyncCalls() {
+    // Service calls are bounded by the send timeout and retry budget, so this cannot block forever.
+    std::unique_lock<std::mutex> lock(m_asyncCallMutex);
+    m_asyncCallConditionVariable.wait(lock, [this]() { return m_asyncCallsInFlight == 0; });
+}
 
-    std::unique_ptr<WebSocketGetFleetRoleCredentialsResponse> webSocketResponse(
-        static_cast<WebSocketGetFleetRoleCredentialsResponse *>(rawResponse.GetResult()));
+std::map<std::string, Aws::GameLift::Internal::RequestWindow::ActionLatency> Aws::GameLift::Internal::GameLiftServerState::GetRequestLatencies() const {
+    if (!m_requestWindow) {
+        return std::map<std::string, RequestWindow::ActionLatency>();
+    }
+    return m_requestWindow->GetActionLatencies();
+}
 
-    // If we get a success response from APIGW with empty fields we're not on managed EC2 or managed containers.
-    if (webSocketResponse->GetAccessKeyId().empty()) {
-        m_onManagedEC2OrContainers = false;
-        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION,
-            "Fleet role credentials not available for Anywhere fleet."));
+Aws::GameLift::Internal::WebSocketConnectMetrics Aws::GameLift::Internal::GameLiftServerState::GetConnectMetrics() const {
+    if (!m_webSocketClientWrapper) {
+        return WebSocketConnectMetrics();
     }
+    return m_webSocketClientWrapper->GetConnectMetrics();
+}
 
-    auto result = Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(webSocketResponse.get());
-    m_instanceRoleResultCache[webSocketRequest.GetRoleArn()] = result;
-    return GetFleetRoleCredentialsOutcome(result);
+int Aws::GameLift::Internal::GameLiftServerState::GetMaxInFlightRequests() {
+    const char *maxInFlightRequests = std::getenv(ENV_VAR_MAX_IN_FLIGHT_REQUESTS);
+    if (maxInFlightRequests != nullptr) {
+        int value = std::atoi(maxInFlightRequests);
+        if (value > PendingRequestTable::CAPACITY) {
+            spdlog::warn("{} value {} exceeds the pending request capacity, using {}", ENV_VAR_MAX_IN_FLIGHT_REQUESTS, value, PendingRequestTable::CAPACITY);
+            value = PendingRequestTable::CAPACITY;
+        }
+        if (value > 0) {
+            spdlog::info("Env override for maxInFlightRequests: {}", value);
+            return value;
+        }
+        spdlog::warn("Ignoring invalid {} value: {}", ENV_VAR_MAX_IN_FLIGHT_REQUESTS, maxInFlightRequests);
+    }
+    return RequestWindow::DEFAULT_MAX_IN_FLIGHT_REQUESTS;
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::GetOverrideParams(
@@ -1086,9 +1123,10 @@ void Aws::GameLift::Internal::GameLiftServerState::GetOverrideParams(
     if (*processId != nullptr) {
         spdlog::info("Env override for processId: {}", *processId);
         if (std::strcmp(*processId, AGENTLESS_CONTAINER_PROCESS_ID) == 0) {
-            std::string guidValue = GuidGenerator::GenerateGuid();
-            *processId = new char[guidValue.size() + 1];
-            std::strcpy(*processId, guidValue.c_str());
+            char guidValue[GuidGenerator::GUID_LENGTH + 1];
+            GuidGenerator::GenerateGuid(guidValue);
+            *processId = new char[sizeof(guidValue)];
+            std::memcpy(*processId, guidValue, sizeof(guidValue));
             spdlog::info("Auto Generated ProcessId, new value is: {}", *processId);
         }
     }
@@ -1133,26 +1171,45 @@ Outcome<std::map<std::string, std::string>, std::string> Aws::GameLift::Internal
     return AwsSigV4Utility::GenerateSigV4QueryParameters(sigV4Params);
 }
 
-void Aws::GameLift::Internal::GameLiftServerState::HealthCheck() {
-    // Seed the random number generator used to generate healthCheck interval jitters
-    std::srand(std::time(0));
+void Aws::GameLift::Internal::GameLiftServerState::StartHeartbeatScheduler(const HeartbeatScheduler::HealthProbe &probe) {
+    if (m_heartbeatScheduler) {
+        // ProcessReady again after ProcessEnding; the health callback may have changed.
+        m_heartbeatScheduler->Stop();
+    }
+    const int intervalMillis = GetHealthCheckIntervalMillis();
+    // Keep the default 60s +/- 10s proportions, and give the callback until the earliest next beat.
+    const int maxJitterMillis = intervalMillis * HEALTHCHECK_MAX_JITTER_MILLIS / HEALTHCHECK_INTERVAL_MILLIS;
+    const int timeoutMillis = intervalMillis - maxJitterMillis;
+    m_heartbeatScheduler.reset(new HeartbeatScheduler(probe, [this](bool healthy) { ReportHealth(healthy); }, intervalMillis, maxJitterMillis, timeoutMillis));
+    m_heartbeatScheduler->Start();
+}
 
-    while (m_processReady) {
-        std::ignore = std::async(std::launch::async, &Internal::GameLiftServerState::ReportHealth, this);
-        std::chrono::duration<long int, std::ratio<1, 1000>> time = std::chrono::milliseconds(GetNextHealthCheckIntervalMillis());
-        std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-        // If the lambda below returns false, the thread will wait until "time" millis expires. If
-        // it returns true, the thread immediately continues.
-        spdlog::info("Performing HealthCheck(), processReady is true, wait for {} ms for next health check", time.count());
-        m_healthCheckConditionVariable.wait_for(lock, time, [&]() { return m_healthCheckInterrupted; });
+void Aws::GameLift::Internal::GameLiftServerState::ReportHealth(bool healthy) {
+    if (m_webSocketClientManager || m_webSocketClientWrapper) {
+        spdlog::info("Trying to report process health as {} for process {}", healthy, m_processId);
+        std::shared_ptr<Message> msg = std::make_shared<Aws::GameLift::Internal::HeartbeatServerProcessRequest>(
+            Aws::GameLift::Internal::HeartbeatServerProcessRequest().WithHealthy(healthy));
+        SendSocketMessageWithRetriesAsync(msg, [this](const GenericOutcome &outcome) {
+            if (!outcome.IsSuccess()) {
+                spdlog::error("Error reporting process health for process {}.", m_processId);
+            }
+        });
+    } else {
+        spdlog::error("Tried to report process health for process {} with no active connection", m_processId);
     }
 }
 
-int Aws::GameLift::Internal::GameLiftServerState::GetNextHealthCheckIntervalMillis() {
-    // Jitter the healthCheck interval +/- a random value between [-MAX_JITTER_SECONDS,
-    // MAX_JITTER_SECONDS]
-    int jitter = std::rand() % (HEALTHCHECK_MAX_JITTER_MILLIS * 2 + 1) - HEALTHCHECK_MAX_JITTER_MILLIS;
-    return HEALTHCHECK_INTERVAL_MILLIS + jitter;
+int Aws::GameLift::Internal::GameLiftServerState::GetHealthCheckIntervalMillis() {
+    const char *healthCheckInterval = std::getenv(ENV_VAR_HEALTHCHECK_INTERVAL_MILLIS);
+    if (healthCheckInterval != nullptr) {
+        int value = std::atoi(healthCheckInterval);
+        if (value >= HEALTHCHECK_MIN_INTERVAL_MILLIS) {
+            spdlog::info("Env override for healthCheckIntervalMillis: {}", value);
+            return value;
+        }
+        spdlog::warn("Ignoring invalid {} value: {}", ENV_VAR_HEALTHCHECK_INTERVAL_MILLIS, healthCheckInterval);
+    }
+    return HEALTHCHECK_INTERVAL_MILLIS;
 }
 
 #if defined(__GNUC__) || defined(__clang__)
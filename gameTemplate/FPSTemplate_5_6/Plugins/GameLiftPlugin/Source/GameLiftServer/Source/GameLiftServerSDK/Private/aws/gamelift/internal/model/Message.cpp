@@ -11,30 +11,42 @@
  */
 
 #include <aws/gamelift/internal/model/Message.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
-#include <aws/gamelift/internal/util/RandomStringGenerator.h>
+#include <aws/gamelift/internal/util/JsonParseArena.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
 std::string Message::Serialize() const {
-    // Create the buffer & Writer for the object
     rapidjson::StringBuffer buffer;
+    if (SerializeTo(buffer)) {
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
+    return "";
+}
+
+const JsonSchema<Message>::Field Message::FIELDS[] = {
+    {ACTION, &Message::m_action},
+    {REQUEST_ID, &Message::m_requestId},
+};
+
+bool Message::SerializeTo(rapidjson::StringBuffer &buffer) const {
+    // Reuse the buffer's memory, but not its contents
+    buffer.Clear();
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
     // Start the object and call Serialize to serialize.
     writer.StartObject();
     if (Serialize(&writer)) {
         writer.EndObject();
-        return buffer.GetString();
+        return true;
     }
-    return "";
+    return false;
 }
 
 bool Message::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
-    rapidjson::Document doc;
+    JsonParseArena::Document doc;
     if (doc.Parse(jsonString.c_str()).HasParseError()) {
         return false;
     }
@@ -44,14 +56,12 @@ bool Message::Deserialize(const std::string &jsonString) {
 }
 
 bool Message::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    JsonHelper::WriteNonEmptyString(writer, ACTION, m_action);
-    JsonHelper::WriteNonEmptyString(writer, REQUEST_ID, m_requestId);
+    JsonSchema<Message>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool Message::Deserialize(const rapidjson::Value &value) {
-    m_action = JsonHelper::SafelyDeserializeString(value, ACTION);
-    m_requestId = JsonHelper::SafelyDeserializeString(value, REQUEST_ID);
+    JsonSchema<Message>::Read(value, *this, FIELDS);
     return true;
 }
 
@@ -60,8 +70,6 @@ std::ostream &operator<<(std::ostream &os, const Message &message) {
     return os;
 }
 
-std::string Message::GenerateRandomRequestId() { return RandomStringGenerator::GenerateRandomAlphaNumericString(32); }
-
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
@@ -11,22 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/ResponseMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<ResponseMessage>::Field ResponseMessage::FIELDS[] = {
+    {STATUS_CODE, &ResponseMessage::m_statusCode},
+    {ERROR_MESSAGE, &ResponseMessage::m_errorMessage},
+};
+
 bool ResponseMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WritePositiveInt(writer, STATUS_CODE, m_statusCode);
-    JsonHelper::WriteNonEmptyString(writer, ERROR_MESSAGE, m_errorMessage);
+    JsonSchema<ResponseMessage>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool ResponseMessage::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_statusCode = JsonHelper::SafelyDeserializeInt(value, STATUS_CODE);
-    m_errorMessage = JsonHelper::SafelyDeserializeString(value, ERROR_MESSAGE);
+    JsonSchema<ResponseMessage>::Read(value, *this, FIELDS);
     return true;
 }
 
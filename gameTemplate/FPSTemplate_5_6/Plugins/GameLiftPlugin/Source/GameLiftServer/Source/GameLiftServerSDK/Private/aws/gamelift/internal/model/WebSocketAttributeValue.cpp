@@ -10,6 +10,9 @@
  */
 
 #include <aws/gamelift/internal/model/WebSocketAttributeValue.h>
+#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonParseArena.h>
+#include <cstring>
 #include <spdlog/spdlog.h>
 
 namespace Aws {
@@ -33,7 +36,7 @@ std::string WebSocketAttributeValue::Serialize() const {
 
 bool WebSocketAttributeValue::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
-    rapidjson::Document doc;
+    JsonParseArena::Document doc;
     if (doc.Parse(jsonString.c_str()).HasParseError()) {
         spdlog::error("WebSocketAttributeValue: Parse error found for: {}", jsonString);
         return false;
@@ -82,20 +85,94 @@ bool WebSocketAttributeValue::Serialize(rapidjson::Writer<rapidjson::StringBuffe
     return true;
 }
 
+void WebSocketAttributeValue::SerializeFrom(rapidjson::Writer<rapidjson::StringBuffer> *writer, const Server::Model::AttributeValue &value) {
+    writer->String(ATTR_TYPE);
+
+    switch (value.GetType()) {
+    case Server::Model::AttributeValue::AttrType::STRING:
+        writer->String(STRING);
+        writer->String(S);
+#ifdef GAMELIFT_USE_STD
+        writer->String(value.GetS().c_str(), static_cast<rapidjson::SizeType>(value.GetS().size()));
+#else
+        writer->String(value.GetS());
+#endif
+        break;
+    case Server::Model::AttributeValue::AttrType::DOUBLE:
+        writer->String(DOUBLE);
+        writer->String(N);
+        writer->Double(value.GetN());
+        break;
+    case Server::Model::AttributeValue::AttrType::STRING_LIST: {
+        writer->String(STRING_LIST);
+        writer->String(SL);
+        writer->StartArray();
+#ifdef GAMELIFT_USE_STD
+        for (const std::string &item : value.GetSL()) {
+            writer->String(item.c_str(), static_cast<rapidjson::SizeType>(item.size()));
+        }
+#else
+        int count = 0;
+        const Server::Model::AttributeValue::AttributeStringType *items = value.GetSL(count);
+        for (int i = 0; i < count; i++) {
+            writer->String(items[i]);
+        }
+#endif
+        writer->EndArray();
+        break;
+    }
+    case Server::Model::AttributeValue::AttrType::STRING_DOUBLE_MAP: {
+        writer->String(STRING_DOUBLE_MAP);
+        writer->String(SDM);
+        writer->StartObject();
+#ifdef GAMELIFT_USE_STD
+        for (auto const &entry : value.GetSDM()) {
+            writer->String(entry.first.c_str(), static_cast<rapidjson::SizeType>(entry.first.size()));
+            writer->Double(entry.second);
+        }
+#else
+        // The fixed-size map does not reject duplicate keys; the last one wins, as it did when this went
+        // through std::map.
+        int count = 0;
+        const Server::Model::AttributeValue::KeyAndValue *entries = value.GetSDM(count);
+        for (int i = 0; i < count; i++) {
+            bool overridden = false;
+            for (int j = i + 1; j < count && !overridden; j++) {
+                overridden = strcmp(entries[i].GetKey(), entries[j].GetKey()) == 0;
+            }
+            if (!overridden) {
+                writer->String(entries[i].GetKey());
+                writer->Double(entries[i].GetValue());
+            }
+        }
+#endif
+        writer->EndObject();
+        break;
+    }
+    default:
+        writer->String(NONE);
+        break;
+    }
+}
+
 bool WebSocketAttributeValue::Deserialize(const rapidjson::Value &value) {
-    std::string attrString = value.HasMember(ATTR_TYPE) ? value[ATTR_TYPE].GetString() : "";
+    const rapidjson::Value *member = JsonHelper::FindMember(value, ATTR_TYPE);
+    std::string attrString = member ? member->GetString() : "";
     SetAttributeType(attrString);
 
     switch (m_attrType) {
     case WebSocketAttrType::STRING:
-        m_S = value.HasMember(S) ? value[S].GetString() : "";
+        member = JsonHelper::FindMember(value, S);
+        m_S = member ? member->GetString() : "";
         break;
     case WebSocketAttrType::DOUBLE:
-        m_N = value.HasMember(N) ? value[N].GetDouble() : 0;
+        member = JsonHelper::FindMember(value, N);
+        m_N = member ? member->GetDouble() : 0;
         break;
     case WebSocketAttrType::STRING_LIST:
-        if (value.HasMember(SL)) {
-            const rapidjson::Value &slValue = value[SL];
+        member = JsonHelper::FindMember(value, SL);
+        if (member) {
+            const rapidjson::Value &slValue = *member;
             std::vector<std::string> sl;
             for (rapidjson::SizeType i = 0; i < slValue.GetArray().Size(); i++) {
                 sl.push_back(slValue.GetArray()[i].GetString());
@@ -104,8 +181,9 @@ bool WebSocketAttributeValue::Deserialize(const rapidjson::Value &value) {
         }
         break;
     case WebSocketAttrType::STRING_DOUBLE_MAP:
-        if (value.HasMember(SDM)) {
-            const rapidjson::Value &sdmValue = value[SDM];
+        member = JsonHelper::FindMember(value, SDM);
+        if (member) {
+            const rapidjson::Value &sdmValue = *member;
             std::map<std::string, double> sdm;
             for (rapidjson::Value::ConstMemberIterator iter = sdmValue.MemberBegin(); iter != sdmValue.MemberEnd(); ++iter) {
                 sdm[iter->name.GetString()] = iter->value.GetDouble();
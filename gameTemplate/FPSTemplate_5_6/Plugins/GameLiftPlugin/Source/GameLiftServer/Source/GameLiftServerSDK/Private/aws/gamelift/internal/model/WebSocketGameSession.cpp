@@ -12,6 +12,7 @@
 
 #include <aws/gamelift/internal/model/WebSocketGameSession.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonParseArena.h>
 #include <spdlog/spdlog.h>
 
 namespace Aws {
@@ -33,9 +34,21 @@ std::string WebSocketGameSession::Serialize() const {
     return "";
 }
 
+const JsonSchema<WebSocketGameSession>::Field WebSocketGameSession::FIELDS[] = {
+    {GAME_SESSION_ID, &WebSocketGameSession::m_gameSessionId},
+    {NAME, &WebSocketGameSession::m_name},
+    {FLEET_ID, &WebSocketGameSession::m_fleetId},
+    {GAME_SESSION_DATA, &WebSocketGameSession::m_gameSessionData},
+    {MATCHMAKER_DATA, &WebSocketGameSession::m_matchmakerData},
+    {DNS_NAME, &WebSocketGameSession::m_dnsName},
+    {IP_ADDRESS, &WebSocketGameSession::m_ipAddress},
+    {MAXIMUM_PLAYER_SESSION_COUNT, &WebSocketGameSession::m_maximumPlayerSessionCount},
+    {PORT, &WebSocketGameSession::m_port},
+};
+
 bool WebSocketGameSession::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
-    rapidjson::Document doc;
+    JsonParseArena::Document doc;
     if (doc.Parse(jsonString.c_str()).HasParseError()) {
         spdlog::error("WebSocketGameSession: Parse error found for: {}", jsonString);
         return false;
@@ -46,15 +59,7 @@ bool WebSocketGameSession::Deserialize(const std::string &jsonString) {
 }
 
 bool WebSocketGameSession::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, NAME, m_name);
-    JsonHelper::WriteNonEmptyString(writer, FLEET_ID, m_fleetId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_DATA, m_gameSessionData);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKER_DATA, m_matchmakerData);
-    JsonHelper::WriteNonEmptyString(writer, DNS_NAME, m_dnsName);
-    JsonHelper::WriteNonEmptyString(writer, IP_ADDRESS, m_ipAddress);
-    JsonHelper::WritePositiveInt(writer, MAXIMUM_PLAYER_SESSION_COUNT, m_maximumPlayerSessionCount);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
+    JsonSchema<WebSocketGameSession>::Write(writer, *this, FIELDS);
 
     writer->String(GAME_PROPERTIES);
     writer->StartObject();
@@ -67,21 +72,14 @@ bool WebSocketGameSession::Serialize(rapidjson::Writer<rapidjson::StringBuffer>
 }
 
 bool WebSocketGameSession::Deserialize(const rapidjson::Value &value) {
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_name = JsonHelper::SafelyDeserializeString(value, NAME);
-    m_fleetId = JsonHelper::SafelyDeserializeString(value, FLEET_ID);
-    m_gameSessionData = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_DATA);
-    m_matchmakerData = JsonHelper::SafelyDeserializeString(value, MATCHMAKER_DATA);
-    m_dnsName = JsonHelper::SafelyDeserializeString(value, DNS_NAME);
-    m_ipAddress = JsonHelper::SafelyDeserializeString(value, IP_ADDRESS);
+    JsonSchema<WebSocketGameSession>::Read(value, *this, FIELDS);
 
-    m_maximumPlayerSessionCount = JsonHelper::SafelyDeserializeInt(value, MAXIMUM_PLAYER_SESSION_COUNT);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
 
-    if (value.HasMember(GAME_PROPERTIES) && !value[GAME_PROPERTIES].IsNull()) {
-        for (auto itr = value[GAME_PROPERTIES].MemberBegin(); itr != value[GAME_PROPERTIES].MemberEnd(); ++itr) {
+    const rapidjson::Value *gameProperties = JsonHelper::FindMember(value, GAME_PROPERTIES);
+    if (gameProperties && !gameProperties->IsNull()) {
+        for (auto itr = gameProperties->MemberBegin(); itr != gameProperties->MemberEnd(); ++itr) {
             if (itr->name.IsString() && itr->value.IsString()) {
-                m_gameProperties[itr->name.GetString()] = itr->value.GetString();
+                m_gameProperties[std::string(itr->name.GetString(), itr->name.GetStringLength())].assign(itr->value.GetString(), itr->value.GetStringLength());
             }
         }
     }
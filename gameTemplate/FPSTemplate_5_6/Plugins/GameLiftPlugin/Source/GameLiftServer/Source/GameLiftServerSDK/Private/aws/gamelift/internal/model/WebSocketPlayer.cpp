@@ -11,6 +11,8 @@
 
 #include <aws/gamelift/internal/model/WebSocketPlayer.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonParseArena.h>
+#include <cstring>
 #include <iostream>
 #include <spdlog/spdlog.h>
 
@@ -38,9 +40,14 @@ std::string WebSocketPlayer::Serialize() const {
     return "";
 }
 
+const JsonSchema<WebSocketPlayer>::Field WebSocketPlayer::FIELDS[] = {
+    {PLAYER_ID, &WebSocketPlayer::m_playerId},
+    {TEAM, &WebSocketPlayer::m_team},
+};
+
 bool WebSocketPlayer::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
-    rapidjson::Document doc;
+    JsonParseArena::Document doc;
     if (doc.Parse(jsonString.c_str()).HasParseError()) {
         spdlog::error("WebSocketPlayer: Parse error found for: {}", jsonString);
         return false;
@@ -52,7 +59,7 @@ bool WebSocketPlayer::Deserialize(const std::string &jsonString) {
 
 bool WebSocketPlayer::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
 
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_ID, m_playerId);
+    JsonSchema<WebSocketPlayer>::Write(writer, *this, FIELDS);
 
     writer->String(PLAYER_ATTRIBUTES);
     writer->StartObject();
@@ -72,18 +79,74 @@ bool WebSocketPlayer::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writ
     }
     writer->EndObject();
 
-    JsonHelper::WriteNonEmptyString(writer, TEAM, m_team);
-
     return true;
 }
 
+void WebSocketPlayer::SerializeFrom(rapidjson::Writer<rapidjson::StringBuffer> *writer, const Server::Model::Player &player) {
+    JsonHelper::WriteNonEmptyString(writer, PLAYER_ID, player.GetPlayerId());
+
+    writer->String(PLAYER_ATTRIBUTES);
+    writer->StartObject();
+#ifdef GAMELIFT_USE_STD
+    for (auto const &attribute : player.GetPlayerAttributes()) {
+        writer->String(attribute.first.c_str(), static_cast<rapidjson::SizeType>(attribute.first.size()));
+        writer->StartObject();
+        WebSocketAttributeValue::SerializeFrom(writer, attribute.second);
+        writer->EndObject();
+    }
+#else
+    // The fixed-size arrays do not reject duplicate names; the last one wins, as it did when players
+    // were converted through std::map.
+    int attributeCount = 0;
+    const Server::Model::Player::NamedAttribute *attributes = player.GetPlayerAttributes(attributeCount);
+    for (int i = 0; i < attributeCount; i++) {
+        bool overridden = false;
+        for (int j = i + 1; j < attributeCount && !overridden; j++) {
+            overridden = strcmp(attributes[i].GetName(), attributes[j].GetName()) == 0;
+        }
+        if (!overridden) {
+            writer->String(attributes[i].GetName());
+            writer->StartObject();
+            WebSocketAttributeValue::SerializeFrom(writer, attributes[i].GetValue());
+            writer->EndObject();
+        }
+    }
+#endif
+    writer->EndObject();
+
+    writer->String(LATENCY_IN_MS);
+    writer->StartObject();
+#ifdef GAMELIFT_USE_STD
+    for (auto const &latency : player.GetLatencyInMs()) {
+        writer->String(latency.first.c_str(), static_cast<rapidjson::SizeType>(latency.first.size()));
+        writer->Int(latency.second);
+    }
+#else
+    int latencyCount = 0;
+    const Server::Model::Player::RegionAndLatency *latencies = player.GetLatencyMs(latencyCount);
+    for (int i = 0; i < latencyCount; i++) {
+        bool overridden = false;
+        for (int j = i + 1; j < latencyCount && !overridden; j++) {
+            overridden = strcmp(latencies[i].GetRegion(), latencies[j].GetRegion()) == 0;
+        }
+        if (!overridden) {
+            writer->String(latencies[i].GetRegion());
+            writer->Int(latencies[i].GetLatencyMs());
+        }
+    }
+#endif
+    writer->EndObject();
+
+    JsonHelper::WriteNonEmptyString(writer, TEAM, player.GetTeam());
+}
+
 bool WebSocketPlayer::Deserialize(const rapidjson::Value &value) {
 
-    m_playerId = JsonHelper::SafelyDeserializeString(value, PLAYER_ID);
-    m_team = JsonHelper::SafelyDeserializeString(value, TEAM);
+    JsonSchema<WebSocketPlayer>::Read(value, *this, FIELDS);
 
-    if (value.HasMember(PLAYER_ATTRIBUTES) && !value[PLAYER_ATTRIBUTES].IsNull()) {
-        for (auto itr = value[PLAYER_ATTRIBUTES].MemberBegin(); itr != value[PLAYER_ATTRIBUTES].MemberEnd(); ++itr) {
+    const rapidjson::Value *playerAttributes = JsonHelper::FindMember(value, PLAYER_ATTRIBUTES);
+    if (playerAttributes && !playerAttributes->IsNull()) {
+        for (auto itr = playerAttributes->MemberBegin(); itr != playerAttributes->MemberEnd(); ++itr) {
             if (itr->name.IsString() && !itr->value.IsNull()) {
                 WebSocketAttributeValue value;
                 value.Deserialize(itr->value);
@@ -92,8 +155,9 @@ bool WebSocketPlayer::Deserialize(const rapidjson::Value &value) {
         }
     }
 
-    if (value.HasMember(LATENCY_IN_MS) && !value[LATENCY_IN_MS].IsNull()) {
-        for (auto itr = value[LATENCY_IN_MS].MemberBegin(); itr != value[LATENCY_IN_MS].MemberEnd(); ++itr) {
+    const rapidjson::Value *latencyInMs = JsonHelper::FindMember(value, LATENCY_IN_MS);
+    if (latencyInMs && !latencyInMs->IsNull()) {
+        for (auto itr = latencyInMs->MemberBegin(); itr != latencyInMs->MemberEnd(); ++itr) {
             if (itr->name.IsString() && itr->value.IsInt()) {
                 m_latencyInMs[itr->name.GetString()] = itr->value.GetInt();
             }
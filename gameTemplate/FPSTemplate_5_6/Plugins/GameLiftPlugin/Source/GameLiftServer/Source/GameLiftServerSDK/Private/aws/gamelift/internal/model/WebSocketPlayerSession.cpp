@@ -15,33 +15,28 @@
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<WebSocketPlayerSession>::Field WebSocketPlayerSession::FIELDS[] = {
+    {PLAYER_SESSION_ID, &WebSocketPlayerSession::m_playerSessionId},
+    {PLAYER_ID, &WebSocketPlayerSession::m_playerId},
+    {GAME_SESSION_ID, &WebSocketPlayerSession::m_gameSessionId},
+    {FLEET_ID, &WebSocketPlayerSession::m_fleetId},
+    {CREATION_TIME, &WebSocketPlayerSession::m_creationTime},
+    {TERMINATION_TIME, &WebSocketPlayerSession::m_terminationTime},
+    {IP_ADDRESS, &WebSocketPlayerSession::m_ipAddress},
+    {PORT, &WebSocketPlayerSession::m_port},
+    {PLAYER_DATA, &WebSocketPlayerSession::m_playerData},
+    {DNS_NAME, &WebSocketPlayerSession::m_dnsName},
+};
+
 bool WebSocketPlayerSession::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_ID, m_playerId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, FLEET_ID, m_fleetId);
-    JsonHelper::WritePositiveInt64(writer, CREATION_TIME, m_creationTime);
-    JsonHelper::WritePositiveInt64(writer, TERMINATION_TIME, m_terminationTime);
+    JsonSchema<WebSocketPlayerSession>::Write(writer, *this, FIELDS);
     JsonHelper::WriteNonEmptyString(writer, STATUS, WebSocketPlayerSessionStatusMapper::GetNameForStatus(m_status));
-    JsonHelper::WriteNonEmptyString(writer, IP_ADDRESS, m_ipAddress);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_DATA, m_playerData);
-    JsonHelper::WriteNonEmptyString(writer, DNS_NAME, m_dnsName);
     return true;
 }
 
 bool WebSocketPlayerSession::Deserialize(const rapidjson::Value &value) {
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
-    m_playerId = JsonHelper::SafelyDeserializeString(value, PLAYER_ID);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_fleetId = JsonHelper::SafelyDeserializeString(value, FLEET_ID);
-    m_creationTime = JsonHelper::SafelyDeserializeInt64(value, CREATION_TIME);
-    m_terminationTime = JsonHelper::SafelyDeserializeInt64(value, TERMINATION_TIME);
+    JsonSchema<WebSocketPlayerSession>::Read(value, *this, FIELDS);
     m_status = WebSocketPlayerSessionStatusMapper::GetStatusForName(JsonHelper::SafelyDeserializeString(value, STATUS));
-    m_ipAddress = JsonHelper::SafelyDeserializeString(value, IP_ADDRESS);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
-    m_playerData = JsonHelper::SafelyDeserializeString(value, PLAYER_DATA);
-    m_dnsName = JsonHelper::SafelyDeserializeString(value, DNS_NAME);
     return true;
 }
 } // namespace Internal
@@ -17,16 +17,20 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+const JsonSchema<CreateGameSessionMessage>::Field CreateGameSessionMessage::FIELDS[] = {
+    {GAME_SESSION_ID, &CreateGameSessionMessage::m_gameSessionId},
+    {GAME_SESSION_NAME, &CreateGameSessionMessage::m_gameSessionName},
+    {GAME_SESSION_DATA, &CreateGameSessionMessage::m_gameSessionData},
+    {MATCHMAKER_DATA, &CreateGameSessionMessage::m_matchmakerData},
+    {DNS_NAME, &CreateGameSessionMessage::m_dnsName},
+    {IP_ADDRESS, &CreateGameSessionMessage::m_ipAddress},
+    {MAXIMUM_PLAYER_SESSION_COUNT, &CreateGameSessionMessage::m_maximumPlayerSessionCount},
+    {PORT, &CreateGameSessionMessage::m_port},
+};
+
 bool CreateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_NAME, m_gameSessionName);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_DATA, m_gameSessionData);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKER_DATA, m_matchmakerData);
-    JsonHelper::WriteNonEmptyString(writer, DNS_NAME, m_dnsName);
-    JsonHelper::WriteNonEmptyString(writer, IP_ADDRESS, m_ipAddress);
-    JsonHelper::WritePositiveInt(writer, MAXIMUM_PLAYER_SESSION_COUNT, m_maximumPlayerSessionCount);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
+    JsonSchema<CreateGameSessionMessage>::Write(writer, *this, FIELDS);
 
     writer->String(GAME_PROPERTIES);
     writer->StartObject();
@@ -40,19 +44,13 @@ bool CreateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuff
 
 bool CreateGameSessionMessage::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_gameSessionName = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_NAME);
-    m_gameSessionData = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_DATA);
-    m_matchmakerData = JsonHelper::SafelyDeserializeString(value, MATCHMAKER_DATA);
-    m_dnsName = JsonHelper::SafelyDeserializeString(value, DNS_NAME);
-    m_ipAddress = JsonHelper::SafelyDeserializeString(value, IP_ADDRESS);
-    m_maximumPlayerSessionCount = JsonHelper::SafelyDeserializeInt(value, MAXIMUM_PLAYER_SESSION_COUNT);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
+    JsonSchema<CreateGameSessionMessage>::Read(value, *this, FIELDS);
 
-    if (value.HasMember(GAME_PROPERTIES) && !value[GAME_PROPERTIES].IsNull()) {
-        for (auto itr = value[GAME_PROPERTIES].MemberBegin(); itr != value[GAME_PROPERTIES].MemberEnd(); ++itr) {
+    const rapidjson::Value *gameProperties = JsonHelper::FindMember(value, GAME_PROPERTIES);
+    if (gameProperties && !gameProperties->IsNull()) {
+        for (auto itr = gameProperties->MemberBegin(); itr != gameProperties->MemberEnd(); ++itr) {
             if (itr->name.IsString() && itr->value.IsString()) {
-                m_gameProperties[itr->name.GetString()] = itr->value.GetString();
+                m_gameProperties[std::string(itr->name.GetString(), itr->name.GetStringLength())].assign(itr->value.GetString(), itr->value.GetStringLength());
             }
         }
     }
@@ -11,22 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/message/RefreshConnectionMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<RefreshConnectionMessage>::Field RefreshConnectionMessage::FIELDS[] = {
+    {REFRESH_CONNECTION_ENDPOINT, &RefreshConnectionMessage::m_refreshConnectionEndpoint},
+    {AUTH_TOKEN, &RefreshConnectionMessage::m_authToken},
+};
+
 bool RefreshConnectionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, REFRESH_CONNECTION_ENDPOINT, m_refreshConnectionEndpoint);
-    JsonHelper::WriteNonEmptyString(writer, AUTH_TOKEN, m_authToken);
+    JsonSchema<RefreshConnectionMessage>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool RefreshConnectionMessage::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_refreshConnectionEndpoint = JsonHelper::SafelyDeserializeString(value, REFRESH_CONNECTION_ENDPOINT);
-    m_authToken = JsonHelper::SafelyDeserializeString(value, AUTH_TOKEN);
+    JsonSchema<RefreshConnectionMessage>::Read(value, *this, FIELDS);
     return true;
 }
 
@@ -11,21 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/message/TerminateProcessMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+const JsonSchema<TerminateProcessMessage>::Field TerminateProcessMessage::FIELDS[] = {
+    {TERMINATION_TIME, &TerminateProcessMessage::m_terminationTime},
+};
+
 bool TerminateProcessMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WritePositiveInt64(writer, TERMINATION_TIME, m_terminationTime);
+    JsonSchema<TerminateProcessMessage>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool TerminateProcessMessage::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_terminationTime = JsonHelper::SafelyDeserializeInt64(value, TERMINATION_TIME);
+    JsonSchema<TerminateProcessMessage>::Read(value, *this, FIELDS);
     return true;
 }
 
@@ -11,12 +11,16 @@
  */
 
 #include <aws/gamelift/internal/model/message/UpdateGameSessionMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+const JsonSchema<UpdateGameSessionMessage>::Field UpdateGameSessionMessage::FIELDS[] = {
+    {UPDATE_REASON, &UpdateGameSessionMessage::m_updateReason},
+    {BACKFILL_TICKET_ID, &UpdateGameSessionMessage::m_backfillTicketId},
+};
+
 bool UpdateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
     // Serialize game session object
@@ -25,8 +29,7 @@ bool UpdateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuff
     m_gameSession.Serialize(writer);
     writer->EndObject();
     // Serialize update game session fields
-    JsonHelper::WriteNonEmptyString(writer, UPDATE_REASON, m_updateReason);
-    JsonHelper::WriteNonEmptyString(writer, BACKFILL_TICKET_ID, m_backfillTicketId);
+    JsonSchema<UpdateGameSessionMessage>::Write(writer, *this, FIELDS);
 
     return true;
 }
@@ -35,13 +38,13 @@ bool UpdateGameSessionMessage::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
     // Deserialize GameSession
     WebSocketGameSession gameSession;
-    if (value.HasMember(GAME_SESSION) && !value[GAME_SESSION].IsNull()) {
-        gameSession.Deserialize(value[GAME_SESSION]);
+    rapidjson::Value::ConstMemberIterator gameSessionMember = value.FindMember(GAME_SESSION);
+    if (gameSessionMember != value.MemberEnd() && !gameSessionMember->value.IsNull()) {
+        gameSession.Deserialize(gameSessionMember->value);
     }
-    m_gameSession = gameSession;
+    m_gameSession = std::move(gameSession);
     // Deserialize rest of fields
-    m_updateReason = JsonHelper::SafelyDeserializeString(value, UPDATE_REASON);
-    m_backfillTicketId = JsonHelper::SafelyDeserializeString(value, BACKFILL_TICKET_ID);
+    JsonSchema<UpdateGameSessionMessage>::Read(value, *this, FIELDS);
 
     return true;
 }
@@ -11,22 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/request/AcceptPlayerSessionRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<AcceptPlayerSessionRequest>::Field AcceptPlayerSessionRequest::FIELDS[] = {
+    {GAME_SESSION_ID, &AcceptPlayerSessionRequest::m_gameSessionId},
+    {PLAYER_SESSION_ID, &AcceptPlayerSessionRequest::m_playerSessionId},
+};
+
 bool AcceptPlayerSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
+    JsonSchema<AcceptPlayerSessionRequest>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool AcceptPlayerSessionRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
+    JsonSchema<AcceptPlayerSessionRequest>::Read(value, *this, FIELDS);
     return true;
 }
 
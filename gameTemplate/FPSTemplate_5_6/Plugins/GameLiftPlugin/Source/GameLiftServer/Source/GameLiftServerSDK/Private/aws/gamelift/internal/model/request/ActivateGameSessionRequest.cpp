@@ -11,7 +11,6 @@
  */
 
 #include <aws/gamelift/internal/model/request/ActivateGameSessionRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
@@ -21,15 +20,19 @@ ActivateGameSessionRequest::ActivateGameSessionRequest() { SetAction(ACTIVATE_GA
 
 ActivateGameSessionRequest::ActivateGameSessionRequest(std::string gameSessionId) : m_gameSessionId(gameSessionId) { SetAction(ACTIVATE_GAME_SESSION); }
 
+const JsonSchema<ActivateGameSessionRequest>::Field ActivateGameSessionRequest::FIELDS[] = {
+    {GAME_SESSION_ID, &ActivateGameSessionRequest::m_gameSessionId},
+};
+
 bool ActivateGameSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
+    JsonSchema<ActivateGameSessionRequest>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool ActivateGameSessionRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
+    JsonSchema<ActivateGameSessionRequest>::Read(value, *this, FIELDS);
     return true;
 }
 
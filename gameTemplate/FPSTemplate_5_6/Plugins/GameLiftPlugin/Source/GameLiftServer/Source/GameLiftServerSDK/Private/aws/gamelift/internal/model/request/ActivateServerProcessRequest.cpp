@@ -26,24 +26,24 @@ ActivateServerProcessRequest::ActivateServerProcessRequest(std::string sdkVersio
     SetAction(ACTIVATE_SERVER_PROCESS);
 };
 
+const JsonSchema<ActivateServerProcessRequest>::Field ActivateServerProcessRequest::FIELDS[] = {
+    {SDK_VERSION, &ActivateServerProcessRequest::m_sdkVersion},
+    {SDK_LANGUAGE, &ActivateServerProcessRequest::m_sdkLanguage},
+    {SDK_TOOL_NAME, &ActivateServerProcessRequest::m_sdkToolName},
+    {SDK_TOOL_VERSION, &ActivateServerProcessRequest::m_sdkToolVersion},
+    {PORT, &ActivateServerProcessRequest::m_port},
+};
+
 bool ActivateServerProcessRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, SDK_VERSION, m_sdkVersion);
-    JsonHelper::WriteNonEmptyString(writer, SDK_LANGUAGE, m_sdkLanguage);
-    JsonHelper::WriteNonEmptyString(writer, SDK_TOOL_NAME, m_sdkToolName);
-    JsonHelper::WriteNonEmptyString(writer, SDK_TOOL_VERSION, m_sdkToolVersion);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
+    JsonSchema<ActivateServerProcessRequest>::Write(writer, *this, FIELDS);
     JsonHelper::WriteLogParameters(writer, LOG_PATHS, m_logParameters);
     return true;
 }
 
 bool ActivateServerProcessRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_sdkVersion = JsonHelper::SafelyDeserializeString(value, SDK_VERSION);
-    m_sdkLanguage = JsonHelper::SafelyDeserializeString(value, SDK_LANGUAGE);
-    m_sdkToolName = JsonHelper::SafelyDeserializeString(value, SDK_TOOL_NAME);
-    m_sdkToolVersion = JsonHelper::SafelyDeserializeString(value, SDK_TOOL_VERSION);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
+    JsonSchema<ActivateServerProcessRequest>::Read(value, *this, FIELDS);
     m_logParameters = JsonHelper::SafelyDeserializeLogParameters(value, LOG_PATHS);
     return true;
 }
@@ -16,16 +16,19 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+const JsonSchema<HeartbeatServerProcessRequest>::Field HeartbeatServerProcessRequest::FIELDS[] = {
+    {HEALTH_STATUS, &HeartbeatServerProcessRequest::m_healthy},
+};
+
 bool HeartbeatServerProcessRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    writer->String(HEALTH_STATUS);
-    writer->Bool(m_healthy);
+    JsonSchema<HeartbeatServerProcessRequest>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool HeartbeatServerProcessRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_healthy = value.HasMember(HEALTH_STATUS) && value[HEALTH_STATUS].IsBool() ? value[HEALTH_STATUS].GetBool() : false;
+    JsonSchema<HeartbeatServerProcessRequest>::Read(value, *this, FIELDS);
     return true;
 }
 
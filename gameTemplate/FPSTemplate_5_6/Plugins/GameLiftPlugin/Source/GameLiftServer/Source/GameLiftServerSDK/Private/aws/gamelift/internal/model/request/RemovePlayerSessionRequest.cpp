@@ -11,22 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/request/RemovePlayerSessionRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<RemovePlayerSessionRequest>::Field RemovePlayerSessionRequest::FIELDS[] = {
+    {GAME_SESSION_ID, &RemovePlayerSessionRequest::m_gameSessionId},
+    {PLAYER_SESSION_ID, &RemovePlayerSessionRequest::m_playerSessionId},
+};
+
 bool RemovePlayerSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
+    JsonSchema<RemovePlayerSessionRequest>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool RemovePlayerSessionRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
+    JsonSchema<RemovePlayerSessionRequest>::Read(value, *this, FIELDS);
     return true;
 }
 
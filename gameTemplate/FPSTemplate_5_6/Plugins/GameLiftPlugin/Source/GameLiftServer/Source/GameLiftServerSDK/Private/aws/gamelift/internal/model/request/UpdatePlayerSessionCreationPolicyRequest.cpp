@@ -17,16 +17,20 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+const JsonSchema<UpdatePlayerSessionCreationPolicyRequest>::Field UpdatePlayerSessionCreationPolicyRequest::FIELDS[] = {
+    {GAME_SESSION_ID, &UpdatePlayerSessionCreationPolicyRequest::m_gameSessionId},
+};
+
 bool UpdatePlayerSessionCreationPolicyRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
+    JsonSchema<UpdatePlayerSessionCreationPolicyRequest>::Write(writer, *this, FIELDS);
     JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_POLICY, GetPlayerSessionCreationPolicyAsString());
     return true;
 }
 
 bool UpdatePlayerSessionCreationPolicyRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
+    JsonSchema<UpdatePlayerSessionCreationPolicyRequest>::Read(value, *this, FIELDS);
     std::string policyAsString = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_POLICY);
     SetPlayerSessionCreationPolicy(policyAsString);
     return true;
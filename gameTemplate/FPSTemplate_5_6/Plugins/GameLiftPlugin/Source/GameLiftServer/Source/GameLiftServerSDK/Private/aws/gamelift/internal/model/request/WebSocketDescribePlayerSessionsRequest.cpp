@@ -11,20 +11,23 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketDescribePlayerSessionsRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<WebSocketDescribePlayerSessionsRequest>::Field WebSocketDescribePlayerSessionsRequest::FIELDS[] = {
+    {GAME_SESSION_ID, &WebSocketDescribePlayerSessionsRequest::m_gameSessionId},
+    {PLAYER_ID, &WebSocketDescribePlayerSessionsRequest::m_playerId},
+    {PLAYER_SESSION_ID, &WebSocketDescribePlayerSessionsRequest::m_playerSessionId},
+    {PLAYER_SESSION_STATUS_FILTER, &WebSocketDescribePlayerSessionsRequest::m_playerSessionStatusFilter},
+    {NEXT_TOKEN, &WebSocketDescribePlayerSessionsRequest::m_nextToken},
+    {LIMIT, &WebSocketDescribePlayerSessionsRequest::m_limit},
+};
+
 bool WebSocketDescribePlayerSessionsRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
 
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_ID, m_playerId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_STATUS_FILTER, m_playerSessionStatusFilter);
-    JsonHelper::WriteNonEmptyString(writer, NEXT_TOKEN, m_nextToken);
-    JsonHelper::WritePositiveInt(writer, LIMIT, m_limit);
+    JsonSchema<WebSocketDescribePlayerSessionsRequest>::Write(writer, *this, FIELDS);
 
     return true;
 }
@@ -32,12 +35,7 @@ bool WebSocketDescribePlayerSessionsRequest::Serialize(rapidjson::Writer<rapidjs
 bool WebSocketDescribePlayerSessionsRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
 
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_playerId = JsonHelper::SafelyDeserializeString(value, PLAYER_ID);
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
-    m_playerSessionStatusFilter = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_STATUS_FILTER);
-    m_nextToken = JsonHelper::SafelyDeserializeString(value, NEXT_TOKEN);
-    m_limit = JsonHelper::SafelyDeserializeInt(value, LIMIT);
+    JsonSchema<WebSocketDescribePlayerSessionsRequest>::Read(value, *this, FIELDS);
 
     return true;
 }
@@ -11,16 +11,19 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketGetFleetRoleCredentialsRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<WebSocketGetFleetRoleCredentialsRequest>::Field WebSocketGetFleetRoleCredentialsRequest::FIELDS[] = {
+    {ROLE_ARN, &WebSocketGetFleetRoleCredentialsRequest::m_roleArn},
+    {ROLE_SESSION_NAME, &WebSocketGetFleetRoleCredentialsRequest::m_roleSessionName},
+};
+
 bool WebSocketGetFleetRoleCredentialsRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
 
-    JsonHelper::WriteNonEmptyString(writer, ROLE_ARN, m_roleArn);
-    JsonHelper::WriteNonEmptyString(writer, ROLE_SESSION_NAME, m_roleSessionName);
+    JsonSchema<WebSocketGetFleetRoleCredentialsRequest>::Write(writer, *this, FIELDS);
 
     return true;
 }
@@ -28,8 +31,7 @@ bool WebSocketGetFleetRoleCredentialsRequest::Serialize(rapidjson::Writer<rapidj
 bool WebSocketGetFleetRoleCredentialsRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
 
-    m_roleArn = JsonHelper::SafelyDeserializeString(value, ROLE_ARN);
-    m_roleSessionName = JsonHelper::SafelyDeserializeString(value, ROLE_SESSION_NAME);
+    JsonSchema<WebSocketGetFleetRoleCredentialsRequest>::Read(value, *this, FIELDS);
 
     return true;
 }
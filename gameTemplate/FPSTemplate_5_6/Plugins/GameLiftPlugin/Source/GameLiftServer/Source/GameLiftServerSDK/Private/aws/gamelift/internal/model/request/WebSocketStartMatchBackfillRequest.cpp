@@ -19,19 +19,41 @@ namespace Internal {
 
 WebSocketStartMatchBackfillRequest::WebSocketStartMatchBackfillRequest() { SetAction(ACTION); };
 
+const JsonSchema<WebSocketStartMatchBackfillRequest>::Field WebSocketStartMatchBackfillRequest::FIELDS[] = {
+    {TICKET_ID, &WebSocketStartMatchBackfillRequest::m_ticketId},
+    {GAME_SESSION_ARN, &WebSocketStartMatchBackfillRequest::m_gameSessionArn},
+    {MATCHMAKING_CONFIGURATION_ARN, &WebSocketStartMatchBackfillRequest::m_matchmakingConfigurationArn},
+};
+
 bool WebSocketStartMatchBackfillRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
 
-    JsonHelper::WriteNonEmptyString(writer, TICKET_ID, m_ticketId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ARN, m_gameSessionArn);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKING_CONFIGURATION_ARN, m_matchmakingConfigurationArn);
+    JsonSchema<WebSocketStartMatchBackfillRequest>::Write(writer, *this, FIELDS);
 
     writer->String(PLAYERS);
     writer->StartArray();
-    for (const WebSocketPlayer &player : m_players) {
-        writer->StartObject();
-        player.Serialize(writer);
-        writer->EndObject();
+    if (m_playersSource) {
+#ifdef GAMELIFT_USE_STD
+        for (const Server::Model::Player &player : m_playersSource->GetPlayers()) {
+            writer->StartObject();
+            WebSocketPlayer::SerializeFrom(writer, player);
+            writer->EndObject();
+        }
+#else
+        int countOfPlayers = 0;
+        const Server::Model::Player *players = m_playersSource->GetPlayers(countOfPlayers);
+        for (int i = 0; i < countOfPlayers; i++) {
+            writer->StartObject();
+            WebSocketPlayer::SerializeFrom(writer, players[i]);
+            writer->EndObject();
+        }
+#endif
+    } else {
+        for (const WebSocketPlayer &player : m_players) {
+            writer->StartObject();
+            player.Serialize(writer);
+            writer->EndObject();
+        }
     }
     writer->EndArray();
 
@@ -41,13 +63,13 @@ bool WebSocketStartMatchBackfillRequest::Serialize(rapidjson::Writer<rapidjson::
 bool WebSocketStartMatchBackfillRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
 
-    m_ticketId = JsonHelper::SafelyDeserializeString(value, TICKET_ID);
-    m_gameSessionArn = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ARN);
-    m_matchmakingConfigurationArn = JsonHelper::SafelyDeserializeString(value, MATCHMAKING_CONFIGURATION_ARN);
+    JsonSchema<WebSocketStartMatchBackfillRequest>::Read(value, *this, FIELDS);
 
     m_players.clear();
-    if (value.HasMember(PLAYERS) && !value[PLAYERS].IsNull()) {
-        auto playerList = value[PLAYERS].GetArray();
+    m_playersSource.reset();
+    const rapidjson::Value *players = JsonHelper::FindMember(value, PLAYERS);
+    if (players && !players->IsNull()) {
+        auto playerList = players->GetArray();
         for (rapidjson::SizeType i = 0; i < playerList.Size(); i++) {
             auto &player = playerList[i];
             if (!player.IsNull()) {
@@ -11,25 +11,26 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketStopMatchBackfillRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+const JsonSchema<WebSocketStopMatchBackfillRequest>::Field WebSocketStopMatchBackfillRequest::FIELDS[] = {
+    {GAME_SESSION_ARN, &WebSocketStopMatchBackfillRequest::m_gameSessionArn},
+    {MATCHMAKING_CONFIG_ARN, &WebSocketStopMatchBackfillRequest::m_matchmakingConfigurationArn},
+    {TICKET_ID, &WebSocketStopMatchBackfillRequest::m_ticketId},
+};
+
 bool WebSocketStopMatchBackfillRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ARN, m_gameSessionArn);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKING_CONFIG_ARN, m_matchmakingConfigurationArn);
-    JsonHelper::WriteNonEmptyString(writer, TICKET_ID, m_ticketId);
+    JsonSchema<WebSocketStopMatchBackfillRequest>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool WebSocketStopMatchBackfillRequest::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_gameSessionArn = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ARN);
-    m_matchmakingConfigurationArn = JsonHelper::SafelyDeserializeString(value, MATCHMAKING_CONFIG_ARN);
-    m_ticketId = JsonHelper::SafelyDeserializeString(value, TICKET_ID);
+    JsonSchema<WebSocketStopMatchBackfillRequest>::Read(value, *this, FIELDS);
     return true;
 }
 
@@ -16,10 +16,14 @@
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<WebSocketDescribePlayerSessionsResponse>::Field WebSocketDescribePlayerSessionsResponse::FIELDS[] = {
+    {NEXT_TOKEN, &WebSocketDescribePlayerSessionsResponse::m_nextToken},
+};
+
 bool WebSocketDescribePlayerSessionsResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
 
-    JsonHelper::WriteNonEmptyString(writer, NEXT_TOKEN, m_nextToken);
+    JsonSchema<WebSocketDescribePlayerSessionsResponse>::Write(writer, *this, FIELDS);
 
     writer->String(PLAYER_SESSIONS);
     writer->StartArray();
@@ -36,16 +40,18 @@ bool WebSocketDescribePlayerSessionsResponse::Serialize(rapidjson::Writer<rapidj
 bool WebSocketDescribePlayerSessionsResponse::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
 
-    m_nextToken = JsonHelper::SafelyDeserializeString(value, NEXT_TOKEN);
+    JsonSchema<WebSocketDescribePlayerSessionsResponse>::Read(value, *this, FIELDS);
     m_playerSessions.clear();
-    if (value.HasMember(PLAYER_SESSIONS) && !value[PLAYER_SESSIONS].IsNull()) {
-        auto playerSessions = value[PLAYER_SESSIONS].GetArray();
+    const rapidjson::Value *playerSessionsValue = JsonHelper::FindMember(value, PLAYER_SESSIONS);
+    if (playerSessionsValue && !playerSessionsValue->IsNull()) {
+        auto playerSessions = playerSessionsValue->GetArray();
+        m_playerSessions.reserve(playerSessions.Size());
         for (rapidjson::SizeType i = 0; i < playerSessions.Size(); i++) {
             auto &playerSession = playerSessions[i];
             if (!playerSession.IsNull()) {
                 WebSocketPlayerSession webSocketPlayerSession;
                 webSocketPlayerSession.Deserialize(playerSession);
-                m_playerSessions.push_back(webSocketPlayerSession);
+                m_playerSessions.push_back(std::move(webSocketPlayerSession));
             }
         }
     }
@@ -11,16 +11,19 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketGetComputeCertificateResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<WebSocketGetComputeCertificateResponse>::Field WebSocketGetComputeCertificateResponse::FIELDS[] = {
+    {COMPUTE_NAME, &WebSocketGetComputeCertificateResponse::m_computeName},
+    {CERTIFICATE_PATH, &WebSocketGetComputeCertificateResponse::m_certificatePath},
+};
+
 bool WebSocketGetComputeCertificateResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
 
-    JsonHelper::WriteNonEmptyString(writer, COMPUTE_NAME, m_computeName);
-    JsonHelper::WriteNonEmptyString(writer, CERTIFICATE_PATH, m_certificatePath);
+    JsonSchema<WebSocketGetComputeCertificateResponse>::Write(writer, *this, FIELDS);
 
     return true;
 }
@@ -28,8 +31,7 @@ bool WebSocketGetComputeCertificateResponse::Serialize(rapidjson::Writer<rapidjs
 bool WebSocketGetComputeCertificateResponse::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
 
-    m_computeName = JsonHelper::SafelyDeserializeString(value, COMPUTE_NAME);
-    m_certificatePath = JsonHelper::SafelyDeserializeString(value, CERTIFICATE_PATH);
+    JsonSchema<WebSocketGetComputeCertificateResponse>::Read(value, *this, FIELDS);
 
     return true;
 }
@@ -11,20 +11,23 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketGetFleetRoleCredentialsResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<WebSocketGetFleetRoleCredentialsResponse>::Field WebSocketGetFleetRoleCredentialsResponse::FIELDS[] = {
+    {ASSUMED_ROLE_USER_ARN, &WebSocketGetFleetRoleCredentialsResponse::m_assumedRoleUserArn},
+    {ASSUMED_ROLE_ID, &WebSocketGetFleetRoleCredentialsResponse::m_assumedRoleId},
+    {ACCESS_KEY_ID, &WebSocketGetFleetRoleCredentialsResponse::m_accessKeyId},
+    {SECRET_ACCESS_KEY, &WebSocketGetFleetRoleCredentialsResponse::m_secretAccessKey},
+    {SESSION_TOKEN, &WebSocketGetFleetRoleCredentialsResponse::m_sessionToken},
+    {EXPIRATION, &WebSocketGetFleetRoleCredentialsResponse::m_expiration},
+};
+
 bool WebSocketGetFleetRoleCredentialsResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
 
-    JsonHelper::WriteNonEmptyString(writer, ASSUMED_ROLE_USER_ARN, m_assumedRoleUserArn);
-    JsonHelper::WriteNonEmptyString(writer, ASSUMED_ROLE_ID, m_assumedRoleId);
-    JsonHelper::WriteNonEmptyString(writer, ACCESS_KEY_ID, m_accessKeyId);
-    JsonHelper::WriteNonEmptyString(writer, SECRET_ACCESS_KEY, m_secretAccessKey);
-    JsonHelper::WriteNonEmptyString(writer, SESSION_TOKEN, m_sessionToken);
-    JsonHelper::WritePositiveInt64(writer, EXPIRATION, m_expiration);
+    JsonSchema<WebSocketGetFleetRoleCredentialsResponse>::Write(writer, *this, FIELDS);
 
     return true;
 }
@@ -32,12 +35,7 @@ bool WebSocketGetFleetRoleCredentialsResponse::Serialize(rapidjson::Writer<rapid
 bool WebSocketGetFleetRoleCredentialsResponse::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
 
-    m_assumedRoleUserArn = JsonHelper::SafelyDeserializeString(value, ASSUMED_ROLE_USER_ARN);
-    m_assumedRoleId = JsonHelper::SafelyDeserializeString(value, ASSUMED_ROLE_ID);
-    m_accessKeyId = JsonHelper::SafelyDeserializeString(value, ACCESS_KEY_ID);
-    m_secretAccessKey = JsonHelper::SafelyDeserializeString(value, SECRET_ACCESS_KEY);
-    m_sessionToken = JsonHelper::SafelyDeserializeString(value, SESSION_TOKEN);
-    m_expiration = JsonHelper::SafelyDeserializeInt64(value, EXPIRATION);
+    JsonSchema<WebSocketGetFleetRoleCredentialsResponse>::Read(value, *this, FIELDS);
 
     return true;
 }
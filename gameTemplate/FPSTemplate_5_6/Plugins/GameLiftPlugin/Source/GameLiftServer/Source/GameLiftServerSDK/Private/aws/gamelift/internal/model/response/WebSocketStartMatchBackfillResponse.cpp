@@ -11,20 +11,23 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketStartMatchBackfillResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
+const JsonSchema<WebSocketStartMatchBackfillResponse>::Field WebSocketStartMatchBackfillResponse::FIELDS[] = {
+    {TICKET_ID, &WebSocketStartMatchBackfillResponse::m_ticketId},
+};
+
 bool WebSocketStartMatchBackfillResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
     Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, TICKET_ID, m_ticketId);
+    JsonSchema<WebSocketStartMatchBackfillResponse>::Write(writer, *this, FIELDS);
     return true;
 }
 
 bool WebSocketStartMatchBackfillResponse::Deserialize(const rapidjson::Value &value) {
     Message::Deserialize(value);
-    m_ticketId = JsonHelper::SafelyDeserializeString(value, TICKET_ID);
+    JsonSchema<WebSocketStartMatchBackfillResponse>::Read(value, *this, FIELDS);
     return true;
 }
 
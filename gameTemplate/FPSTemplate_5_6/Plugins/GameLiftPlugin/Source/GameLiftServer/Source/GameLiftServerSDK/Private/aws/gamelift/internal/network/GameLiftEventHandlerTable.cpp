@@ -0,0 +1,73 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/GameLiftEventHandlerTable.h>
+#include <cstring>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+// Every action the service sends that the SDK handles. Adding one may require a new hash below; the
+// static_assert will say so.
+constexpr const char *KNOWN_ACTIONS[] = {
+    "CreateGameSession", "DescribePlayerSessions", "GetComputeCertificate", "GetFleetRoleCredentials",
+    "TerminateProcess",  "UpdateGameSession",      "StartMatchBackfill",    "RefreshConnection",
+};
+constexpr std::size_t KNOWN_ACTION_COUNT = sizeof(KNOWN_ACTIONS) / sizeof(KNOWN_ACTIONS[0]);
+constexpr std::size_t SLOT_MASK = 15;
+
+constexpr std::size_t Length(const char *value) { return *value == '\0' ? 0 : 1 + Length(value + 1); }
+
+constexpr std::size_t Slot(const char *action, std::size_t length) {
+    return length == 0 ? 0 : (length + 4 * static_cast<unsigned char>(action[0])) & SLOT_MASK;
+}
+
+constexpr bool IsPerfectHash() {
+    for (std::size_t i = 0; i < KNOWN_ACTION_COUNT; i++) {
+        for (std::size_t j = i + 1; j < KNOWN_ACTION_COUNT; j++) {
+            if (Slot(KNOWN_ACTIONS[i], Length(KNOWN_ACTIONS[i])) == Slot(KNOWN_ACTIONS[j], Length(KNOWN_ACTIONS[j]))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(IsPerfectHash(), "Action names collide in GameLiftEventHandlerTable; choose a different Slot() hash");
+} // namespace
+
+bool GameLiftEventHandlerTable::Register(const std::string &action, const Handler &handler) {
+    for (const char *knownAction : KNOWN_ACTIONS) {
+        if (action == knownAction) {
+            Entry &entry = m_entries[Slot(action.c_str(), action.size())];
+            entry.action = knownAction;
+            entry.length = action.size();
+            entry.handler = handler;
+            return true;
+        }
+    }
+    return false;
+}
+
+const GameLiftEventHandlerTable::Handler *GameLiftEventHandlerTable::Find(const char *action, std::size_t length) const {
+    const Entry &entry = m_entries[Slot(action, length)];
+    if (entry.action == nullptr || entry.length != length || std::memcmp(entry.action, action, length) != 0 || !entry.handler) {
+        return nullptr;
+    }
+    return &entry.handler;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
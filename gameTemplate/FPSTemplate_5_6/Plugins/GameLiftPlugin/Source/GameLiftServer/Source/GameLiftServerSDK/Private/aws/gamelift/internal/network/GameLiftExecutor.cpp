@@ -0,0 +1,64 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/GameLiftExecutor.h>
+#include <spdlog/spdlog.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+GameLiftExecutor &GameLiftExecutor::GetInstance() {
+    // Leaked on purpose: see class comment.
+    static GameLiftExecutor *instance = new GameLiftExecutor();
+    return *instance;
+}
+
+GameLiftExecutor::GameLiftExecutor()
+    : m_ioWorkGuard(asio::make_work_guard(m_ioContext)), m_workers(WORKER_THREAD_COUNT), m_connectionWorker(1), m_ioThread([this] { RunIoContext(); }) {}
+
+void GameLiftExecutor::Post(std::function<void()> task) {
+    asio::post(m_workers, [task]() { RunTask(task); });
+}
+
+void GameLiftExecutor::Post(const Strand &strand, std::function<void()> task) {
+    asio::post(strand, [task]() { RunTask(task); });
+}
+
+void GameLiftExecutor::PostConnectionTask(std::function<void()> task) {
+    asio::post(m_connectionWorker, [task]() { RunTask(task); });
+}
+
+void GameLiftExecutor::RunTask(const std::function<void()> &task) {
+    // An exception escaping a task would take the whole pool down with it.
+    try {
+        task();
+    } catch (const std::exception &e) {
+        spdlog::error("Unhandled exception in SDK task: {}", e.what());
+    }
+}
+
+void GameLiftExecutor::RunIoContext() {
+    while (true) {
+        try {
+            m_ioContext.run();
+            return;
+        } catch (const std::exception &e) {
+            // run() can be resumed after a handler throws; keep servicing the websocket.
+            spdlog::error("Unhandled exception on SDK I/O thread: {}", e.what());
+        }
+    }
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
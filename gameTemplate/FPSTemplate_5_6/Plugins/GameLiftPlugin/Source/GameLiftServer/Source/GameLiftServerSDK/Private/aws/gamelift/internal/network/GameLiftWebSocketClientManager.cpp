@@ -61,11 +61,39 @@ GenericOutcome GameLiftWebSocketClientManager::Connect(std::string websocketUrl,
 }
 
 GenericOutcome GameLiftWebSocketClientManager::SendSocketMessage(Message &message) {
-    // Serialize the message
-    std::string jsonMessage = message.Serialize();
+    auto response = std::make_shared<std::promise<GenericOutcome>>();
+    std::future<GenericOutcome> responseFuture = response->get_future();
+    SendSocketMessageAsync(message, [response](const GenericOutcome &outcome) { response->set_value(outcome); });
+    return responseFuture.get();
+}
+
+void GameLiftWebSocketClientManager::SendSocketMessageAsync(Message &message, const IWebSocketClientWrapper::ResponseCallback &onResponse) {
+    // Wait for room in the in-flight window. A full window is reported as throttling rather than a
+    // retriable send failure, so it does not count towards forcing a reconnect.
+    auto queuedAt = std::chrono::steady_clock::now();
+    std::shared_ptr<RequestWindow> requestWindow = m_requestWindow;
+    std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper = m_webSocketClientWrapper;
+    Message *messageToSend = &message;
+    m_requestWindow->AcquireAsync(std::chrono::milliseconds(RequestWindow::ACQUIRE_TIMEOUT_MILLIS),
+                                  [requestWindow, webSocketClientWrapper, messageToSend, queuedAt, onResponse](bool acquired) {
+        const std::string action = messageToSend->GetAction();
+        if (!acquired) {
+            spdlog::warn("Request window full ({} in flight), rejecting {} request", requestWindow->GetMaxInFlightRequests(), action);
+            requestWindow->RecordLatency(action, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - queuedAt),
+                                         std::chrono::microseconds(0), false);
+            onResponse(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::TOO_MANY_REQUESTS_EXCEPTION)));
+            return;
+        }
+        auto sentAt = std::chrono::steady_clock::now();
 
-    GenericOutcome outcome = m_webSocketClientWrapper->SendSocketMessage(message.GetRequestId(), jsonMessage);
-    return outcome;
+        webSocketClientWrapper->SendSocketMessageAsync(*messageToSend, [requestWindow, action, queuedAt, sentAt, onResponse](const GenericOutcome &outcome) {
+            // Free the slot first: the next queued request goes out, and onResponse may send again.
+            requestWindow->Release();
+            requestWindow->RecordLatency(action, std::chrono::duration_cast<std::chrono::microseconds>(sentAt - queuedAt),
+                                         std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sentAt), outcome.IsSuccess());
+            onResponse(outcome);
+        });
+    });
 }
 
 void GameLiftWebSocketClientManager::Disconnect() { m_webSocketClientWrapper->Disconnect(); }
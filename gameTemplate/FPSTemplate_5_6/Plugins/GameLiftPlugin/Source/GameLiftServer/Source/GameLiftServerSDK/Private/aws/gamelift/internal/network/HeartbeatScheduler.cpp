@@ -0,0 +1,172 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/HeartbeatScheduler.h>
+#include <aws/gamelift/internal/util/ThreadLocalRandom.h>
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#endif
+#include <asio/steady_timer.hpp>
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#include <spdlog/spdlog.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+struct HeartbeatScheduler::State : public std::enable_shared_from_this<HeartbeatScheduler::State> {
+    // One beat's race between the probe and its deadline.
+    struct Beat {
+        explicit Beat(asio::io_context &ioContext) : settled(false), deadline(ioContext) {}
+        std::atomic<bool> settled;
+        asio::steady_timer deadline;
+    };
+
+    State(HealthProbe probe, HealthReporter reporter, int intervalMillis, int maxJitterMillis, int probeTimeoutMillis)
+        : probe(std::move(probe)), reporter(std::move(reporter)), intervalMillis(intervalMillis), maxJitterMillis(maxJitterMillis),
+          probeTimeoutMillis(probeTimeoutMillis), running(false), generation(0), reportsInFlight(0), timer(GameLiftExecutor::GetInstance().GetIoContext()),
+          probeStrand(GameLiftExecutor::GetInstance().MakeStrand()) {}
+
+    // Timer and beat handlers below run on the I/O thread and must not block.
+
+    void ScheduleBeat(uint64_t generation, std::chrono::milliseconds delay) {
+        std::shared_ptr<State> self = shared_from_this();
+        timer.expires_after(delay);
+        timer.async_wait([self, generation](const std::error_code &error) {
+            if (!error) {
+                self->OnBeat(generation);
+            }
+        });
+    }
+
+    void OnBeat(uint64_t generation) {
+        // A beat that expired just before Stop() cancelled it, or one left over from before a restart.
+        if (!IsCurrent(generation)) {
+            return;
+        }
+
+        std::shared_ptr<State> self = shared_from_this();
+        auto beat = std::make_shared<Beat>(GameLiftExecutor::GetInstance().GetIoContext());
+        beat->deadline.expires_after(std::chrono::milliseconds(probeTimeoutMillis));
+        beat->deadline.async_wait([self, beat](const std::error_code &error) {
+            if (error || beat->settled.exchange(true)) {
+                return;
+            }
+            spdlog::warn("Timed out waiting for health response from the server process. Reporting as unhealthy.");
+            self->Report(false);
+        });
+
+        GameLiftExecutor::GetInstance().Post(probeStrand, [self, beat]() {
+            const bool healthy = self->probe ? self->probe() : true;
+            if (beat->settled.exchange(true)) {
+                spdlog::info("Dropping late health response: {}", healthy);
+                return;
+            }
+            asio::post(GameLiftExecutor::GetInstance().GetIoContext(), [beat]() { beat->deadline.cancel(); });
+            spdlog::info("Received Health Response: {}", healthy);
+            self->Report(healthy);
+        });
+
+        const std::chrono::milliseconds next = NextInterval();
+        spdlog::info("Next health check in {} ms", next.count());
+        ScheduleBeat(generation, next);
+    }
+
+    std::chrono::milliseconds NextInterval() const {
+        // Jitter the interval by a random value in [-maxJitterMillis, maxJitterMillis].
+        const uint64_t span = static_cast<uint64_t>(maxJitterMillis) * 2 + 1;
+        const int jitter = static_cast<int>(ThreadLocalRandom::Next() % span) - maxJitterMillis;
+        return std::chrono::milliseconds(intervalMillis + jitter);
+    }
+
+    // Runs on the probe strand or the I/O thread. The reporter only starts the send, so this never
+    // holds up either.
+    void Report(bool healthy) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!running) {
+                return;
+            }
+            reportsInFlight++;
+        }
+        reporter(healthy);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--reportsInFlight == 0) {
+            reportsDone.notify_all();
+        }
+    }
+
+    bool IsCurrent(uint64_t beatGeneration) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return running && beatGeneration == generation;
+    }
+
+    const HealthProbe probe;
+    const HealthReporter reporter;
+    const int intervalMillis;
+    const int maxJitterMillis;
+    const int probeTimeoutMillis;
+
+    std::mutex mutex;
+    std::condition_variable reportsDone;
+    bool running;
+    // Bumped by every Start(), so beats scheduled before a Stop() never fire afterwards.
+    uint64_t generation;
+    int reportsInFlight;
+
+    // Only touched on the I/O thread.
+    asio::steady_timer timer;
+    // A hung health callback only holds up later health checks, not other SDK work.
+    GameLiftExecutor::Strand probeStrand;
+};
+
+HeartbeatScheduler::HeartbeatScheduler(HealthProbe probe, HealthReporter reporter, int intervalMillis, int maxJitterMillis, int probeTimeoutMillis)
+    : m_state(std::make_shared<State>(std::move(probe), std::move(reporter), intervalMillis, maxJitterMillis, probeTimeoutMillis)) {}
+
+HeartbeatScheduler::~HeartbeatScheduler() { Stop(); }
+
+void HeartbeatScheduler::Start() {
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (m_state->running) {
+            return;
+        }
+        m_state->running = true;
+        generation = ++m_state->generation;
+    }
+    std::shared_ptr<State> state = m_state;
+    asio::post(GameLiftExecutor::GetInstance().GetIoContext(), [state, generation]() { state->ScheduleBeat(generation, std::chrono::milliseconds(0)); });
+}
+
+void HeartbeatScheduler::Stop() {
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    if (m_state->running) {
+        m_state->running = false;
+        std::shared_ptr<State> state = m_state;
+        asio::post(GameLiftExecutor::GetInstance().GetIoContext(), [state]() { state->timer.cancel(); });
+    }
+    // Only waits for a reporter call that is starting its send, never for the send itself.
+    m_state->reportsDone.wait(lock, [this]() { return m_state->reportsInFlight == 0; });
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,143 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/PendingRequestTable.h>
+#include <aws/gamelift/internal/util/RandomStringGenerator.h>
+#include <algorithm>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+const char HEX_DIGITS[] = "0123456789abcdef";
+
+int HexValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+} // namespace
+
+PendingRequestTable::PendingRequestTable() : m_nextSlot(0) {
+    // The prefix keeps IDs from different connections (and different processes on the same host)
+    // apart in the service's logs, and lets responses to another table's requests be rejected.
+    RandomStringGenerator::GenerateRandomAlphaNumericString(m_requestIdPrefix, REQUEST_ID_PREFIX_LENGTH);
+}
+
+bool PendingRequestTable::Claim(uint32_t &handle, ResponseHandler onResponse) {
+    // Start each scan at a different slot so concurrent senders rarely contend on the same one.
+    const uint32_t start = m_nextSlot.fetch_add(1, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < CAPACITY; i++) {
+        const uint32_t index = (start + i) & INDEX_MASK;
+        Slot &slot = m_slots[index];
+        uint32_t state = slot.state.load(std::memory_order_relaxed);
+        if ((state & STATUS_MASK) != STATUS_FREE) {
+            continue;
+        }
+        const uint32_t generation = state >> STATUS_BITS;
+        if (!slot.state.compare_exchange_strong(state, (generation << STATUS_BITS) | STATUS_BUSY, std::memory_order_acquire)) {
+            continue;
+        }
+
+        slot.onResponse = std::move(onResponse);
+        slot.state.store((generation << STATUS_BITS) | STATUS_PENDING, std::memory_order_release);
+
+        handle = (generation << INDEX_BITS) | index;
+        return true;
+    }
+    return false;
+}
+
+bool PendingRequestTable::Complete(const std::string &requestId, const GenericOutcome &response) {
+    uint32_t handle;
+    if (!ParseRequestId(requestId, handle)) {
+        return false;
+    }
+    return Complete(handle, response);
+}
+
+bool PendingRequestTable::Complete(uint32_t handle, const GenericOutcome &outcome) {
+    const uint32_t generation = handle >> INDEX_BITS;
+    Slot &slot = m_slots[handle & INDEX_MASK];
+    uint32_t expected = (generation << STATUS_BITS) | STATUS_PENDING;
+    if (!slot.state.compare_exchange_strong(expected, (generation << STATUS_BITS) | STATUS_BUSY, std::memory_order_acquire)) {
+        // Timed out and released, or a stale response for an earlier use of the slot.
+        return false;
+    }
+
+    // Release the slot before running the handler, which may send (and claim) again.
+    ResponseHandler onResponse = std::move(slot.onResponse);
+    slot.onResponse = nullptr;
+    slot.state.store(ReleasedState(generation), std::memory_order_release);
+
+    if (onResponse) {
+        onResponse(outcome);
+    }
+    return true;
+}
+
+bool PendingRequestTable::Cancel(uint32_t handle) {
+    const uint32_t generation = handle >> INDEX_BITS;
+    Slot &slot = m_slots[handle & INDEX_MASK];
+    uint32_t expected = (generation << STATUS_BITS) | STATUS_PENDING;
+    if (!slot.state.compare_exchange_strong(expected, (generation << STATUS_BITS) | STATUS_BUSY, std::memory_order_acquire)) {
+        return false;
+    }
+
+    slot.onResponse = nullptr;
+    slot.state.store(ReleasedState(generation), std::memory_order_release);
+    return true;
+}
+
+void PendingRequestTable::CompleteAll(const GenericOutcome &outcome) {
+    for (uint32_t index = 0; index < CAPACITY; index++) {
+        const uint32_t state = m_slots[index].state.load(std::memory_order_acquire);
+        if ((state & STATUS_MASK) == STATUS_PENDING) {
+            Complete(((state >> STATUS_BITS) << INDEX_BITS) | index, outcome);
+        }
+    }
+}
+
+std::string PendingRequestTable::ToRequestId(uint32_t handle) const {
+    std::string requestId(REQUEST_ID_PREFIX_LENGTH + HANDLE_HEX_DIGITS, '0');
+    std::copy(m_requestIdPrefix, m_requestIdPrefix + REQUEST_ID_PREFIX_LENGTH, requestId.begin());
+    for (int i = HANDLE_HEX_DIGITS - 1; i >= 0; i--) {
+        requestId[REQUEST_ID_PREFIX_LENGTH + i] = HEX_DIGITS[handle & 0xF];
+        handle >>= 4;
+    }
+    return requestId;
+}
+
+bool PendingRequestTable::ParseRequestId(const std::string &requestId, uint32_t &handle) const {
+    if (requestId.size() != REQUEST_ID_PREFIX_LENGTH + HANDLE_HEX_DIGITS || requestId.compare(0, REQUEST_ID_PREFIX_LENGTH, m_requestIdPrefix, REQUEST_ID_PREFIX_LENGTH) != 0) {
+        return false;
+    }
+
+    handle = 0;
+    for (int i = REQUEST_ID_PREFIX_LENGTH; i < REQUEST_ID_PREFIX_LENGTH + HANDLE_HEX_DIGITS; i++) {
+        const int digit = HexValue(requestId[i]);
+        if (digit < 0) {
+            return false;
+        }
+        handle = (handle << 4) | static_cast<uint32_t>(digit);
+    }
+    return true;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
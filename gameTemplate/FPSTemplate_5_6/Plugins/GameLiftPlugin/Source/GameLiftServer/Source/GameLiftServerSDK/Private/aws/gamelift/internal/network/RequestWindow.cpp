@@ -0,0 +1,90 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/RequestWindow.h>
+#include <algorithm>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+RequestWindow::RequestWindow(int maxInFlightRequests) : m_maxInFlightRequests(std::max(1, maxInFlightRequests)), m_inFlightRequests(0) {}
+
+void RequestWindow::AcquireAsync(std::chrono::milliseconds timeout, SlotCallback onSlot) {
+    {
+        std::lock_guard<std::mutex> lock(m_windowMutex);
+        if (m_inFlightRequests >= m_maxInFlightRequests || !m_waiters.empty()) {
+            m_waiters.push_back(Waiter{std::chrono::steady_clock::now() + timeout, std::move(onSlot)});
+            return;
+        }
+        m_inFlightRequests++;
+    }
+    onSlot(true);
+}
+
+void RequestWindow::Release() {
+    // Callbacks run outside the lock; a granted sender may send, and a rejected one may retry.
+    std::deque<SlotCallback> expired;
+    SlotCallback granted;
+    {
+        std::lock_guard<std::mutex> lock(m_windowMutex);
+        const auto now = std::chrono::steady_clock::now();
+        while (!m_waiters.empty() && m_waiters.front().deadline < now) {
+            expired.push_back(std::move(m_waiters.front().onSlot));
+            m_waiters.pop_front();
+        }
+        if (!m_waiters.empty()) {
+            // The released slot passes straight to the next sender, so the count is unchanged.
+            granted = std::move(m_waiters.front().onSlot);
+            m_waiters.pop_front();
+        } else {
+            m_inFlightRequests--;
+        }
+    }
+
+    for (SlotCallback &onSlot : expired) {
+        onSlot(false);
+    }
+    if (granted) {
+        granted(true);
+    }
+}
+
+void RequestWindow::RecordLatency(const std::string &action, std::chrono::microseconds queued, std::chrono::microseconds roundTrip, bool success) {
+    const uint64_t queuedMicros = static_cast<uint64_t>(queued.count());
+    const uint64_t roundTripMicros = static_cast<uint64_t>(roundTrip.count());
+
+    std::lock_guard<std::mutex> lock(m_latencyMutex);
+    ActionLatency &latency = m_actionLatencies[action];
+    latency.requestCount++;
+    if (!success) {
+        latency.failureCount++;
+    }
+    latency.totalQueuedMicros += queuedMicros;
+    latency.maxQueuedMicros = std::max(latency.maxQueuedMicros, queuedMicros);
+    latency.totalRoundTripMicros += roundTripMicros;
+    latency.maxRoundTripMicros = std::max(latency.maxRoundTripMicros, roundTripMicros);
+}
+
+std::map<std::string, RequestWindow::ActionLatency> RequestWindow::GetActionLatencies() const {
+    std::lock_guard<std::mutex> lock(m_latencyMutex);
+    return m_actionLatencies;
+}
+
+int RequestWindow::GetInFlightRequests() const {
+    std::lock_guard<std::mutex> lock(m_windowMutex);
+    return m_inFlightRequests;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -15,6 +15,17 @@
 #include <aws/gamelift/internal/model/ResponseMessage.h>
 #include <aws/gamelift/internal/retry/GeometricBackoffRetryStrategy.h>
 #include <aws/gamelift/internal/retry/RetryingCallable.h>
+#include <aws/gamelift/internal/util/JsonParseArena.h>
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#endif
+#include <asio/steady_timer.hpp>
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#include <algorithm>
+#include <future>
 #include <memory>
 #include <websocketpp/error.hpp>
 #include <spdlog/spdlog.h>
@@ -24,40 +35,25 @@ namespace GameLift {
 namespace Internal {
 
 WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientType> webSocketClient)
-    : m_webSocketClient(webSocketClient), m_connectionStateChanged(false) {
+    : m_webSocketClient(webSocketClient), m_messageManager(std::make_shared<websocketpp::config::asio_tls_client::con_msg_manager_type>()),
+      m_tlsContext(new asio::ssl::context(asio::ssl::context::tls_client)), m_tlsSession(nullptr), m_connecting(false), m_uriGeneration(0) {
     // configure logging. comment these out to get websocket logs on stdout for debugging
     m_webSocketClient->clear_access_channels(websocketpp::log::alevel::all);
     m_webSocketClient->clear_error_channels(websocketpp::log::elevel::all);
 
-    // initialize ASIO
-    m_webSocketClient->init_asio();
-
-    // start in perpetual mode (do not exit processing loop when there are no connections)
-    m_webSocketClient->start_perpetual();
-
-    // Kick off two threads that will own up to two parallel connections. These threads will live
-    // until the SDK is shutdown and alternate handling connections. If a connection fails to open,
-    // the thread will not hang. Instead, the thread will simply wait for another connection to
-    // appear in queue.
-    //
-    // Flow of logic in the two threads:
-    // --- SDK initialized ---
-    // socket_thread_1: waiting for connection...
-    // socket_thread_2: waiting for connection...
-    // --- Initial connection happens ---
-    // socket_thread_1: handling 1st connection
-    // socket_thread_2: waiting for connection...
-    // --- Connection refresh begins ---
-    // socket_thread_1: finish handling 1st connection messages
-    // socket_thread_2: handling 2nd connection
-    // --- Connection 1 closes ---
-    // socket_thread_1: waiting for connection...
-    // socket_thread_2: handling 2nd connection
-    // --- SDK shut down, and WebSocket client "->stop_perpetual()" is invoked ---
-    // socket_thread_1: No longer waits for a connection, thread ends
-    // socket_thread_2: Finishes handling 2nd connection, then thread ends
-    m_socket_thread_1 = std::unique_ptr<std::thread>(new std::thread([this] { m_webSocketClient->run(); }));
-    m_socket_thread_2 = std::unique_ptr<std::thread>(new std::thread([this] { m_webSocketClient->run(); }));
+    // Run on the SDK's shared I/O thread rather than threads of our own. The executor keeps the
+    // io_context alive between connections, so perpetual mode is not needed.
+    m_webSocketClient->init_asio(&GameLiftExecutor::GetInstance().GetIoContext());
+
+    // Build the TLS context up front, at InitSDK, rather than per connection attempt. TLS 1.2 is the
+    // minimum; TLS 1.3 is negotiated when the endpoint supports it. Client-side session caching
+    // hands new sessions to OnNewTlsSession, which keeps the latest one for the next connection.
+    m_tlsContext->set_options(asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2 | asio::ssl::context::no_sslv3 |
+                              asio::ssl::context::no_tlsv1 | asio::ssl::context::no_tlsv1_1);
+    SSL_CTX *nativeContext = m_tlsContext->native_handle();
+    SSL_CTX_set_app_data(nativeContext, this);
+    SSL_CTX_set_session_cache_mode(nativeContext, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(nativeContext, &WebSocketppClientWrapper::OnNewTlsSession);
 
     // Set callbacks
     using std::placeholders::_1;
@@ -68,6 +64,7 @@ WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppCl
     m_webSocketClient->set_open_handshake_timeout(WEBSOCKET_OPEN_HANDSHAKE_TIMEOUT_MILLIS);
 
     m_webSocketClient->set_tls_init_handler(std::bind(&WebSocketppClientWrapper::OnTlsInit, this, _1));
+    m_webSocketClient->set_socket_init_handler(std::bind(&WebSocketppClientWrapper::OnSocketInit, this, _1, _2));
     m_webSocketClient->set_open_handler(std::bind(&WebSocketppClientWrapper::OnConnected, this, _1));
     m_webSocketClient->set_message_handler(std::bind(&WebSocketppClientWrapper::OnMessage, this, _1, _2));
     m_webSocketClient->set_fail_handler(std::bind(&WebSocketppClientWrapper::OnError, this, _1));
@@ -76,48 +73,158 @@ WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppCl
 }
 
 WebSocketppClientWrapper::~WebSocketppClientWrapper() {
-    // stop perpetual mode, allowing the websocketClient to destroy itself
-    if (m_webSocketClient) {
-        m_webSocketClient->stop_perpetual();
+    spdlog::info("Destroying WebsocketPPClientWrapper");
+    std::vector<WebSocketppClientType::connection_ptr> connections;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        connections.swap(m_connections);
     }
 
-    spdlog::info("Destroying WebsocketPPClientWrapper");
-    // close connections and join the thread
-    if (m_connection && m_connection->get_state() == websocketpp::session::state::open) {
-        Disconnect();
+    // Start the close handshake on every connection still open, not only the current one: a
+    // connection being replaced may still be closing.
+    for (const WebSocketppClientType::connection_ptr &connection : connections) {
+        if (connection->get_state() == websocketpp::session::state::open) {
+            websocketpp::lib::error_code ec;
+            m_webSocketClient->close(connection->get_handle(), websocketpp::close::status::going_away, "Websocket client closing", ec);
+        }
     }
-    if (m_socket_thread_1 && m_socket_thread_1->joinable()) {
-        m_socket_thread_1->join();
+    ExchangeConnection(nullptr);
+    FailQueuedMessages();
+
+    // Give the handshakes a chance to finish. When destroyed from a handler on the I/O thread itself
+    // they cannot progress until we return, so don't wait.
+    const bool onIoThread = GameLiftExecutor::GetInstance().IsIoThread();
+    if (!onIoThread) {
+        std::unique_lock<std::mutex> lk(m_lock);
+        m_cond.wait_for(lk, std::chrono::milliseconds(WEBSOCKET_CLOSE_TIMEOUT_MILLIS), [&connections] {
+            return std::all_of(connections.begin(), connections.end(), [](const WebSocketppClientType::connection_ptr &connection) {
+                return connection->get_state() == websocketpp::session::state::closed;
+            });
+        });
     }
-    if (m_socket_thread_2 && m_socket_thread_2->joinable()) {
-        m_socket_thread_2->join();
+
+    // Every handler is bound to "this" and only ever runs on the I/O thread. Unregister them there,
+    // behind any handler already queued, and cancel connections that did not close in time; after
+    // that nothing left on the I/O thread can call back into this wrapper.
+    std::shared_ptr<WebSocketppClientType> webSocketClient = m_webSocketClient;
+    auto detachHandlers = [webSocketClient, connections]() {
+        webSocketClient->set_tls_init_handler(nullptr);
+        webSocketClient->set_socket_init_handler(nullptr);
+        webSocketClient->set_open_handler(nullptr);
+        webSocketClient->set_message_handler(nullptr);
+        webSocketClient->set_fail_handler(nullptr);
+        webSocketClient->set_close_handler(nullptr);
+        webSocketClient->set_interrupt_handler(nullptr);
+        for (const WebSocketppClientType::connection_ptr &connection : connections) {
+            connection->set_open_handler(nullptr);
+            connection->set_message_handler(nullptr);
+            connection->set_fail_handler(nullptr);
+            connection->set_close_handler(nullptr);
+            connection->set_interrupt_handler(nullptr);
+            if (connection->get_state() != websocketpp::session::state::closed) {
+                connection->terminate(websocketpp::error::make_error_code(websocketpp::error::operation_canceled));
+            }
+        }
+    };
+    if (onIoThread) {
+        detachHandlers();
+    } else {
+        std::promise<void> detached;
+        asio::post(GameLiftExecutor::GetInstance().GetIoContext(), [&detachHandlers, &detached]() {
+            detachHandlers();
+            detached.set_value();
+        });
+        detached.get_future().wait();
+    }
+
+    // No response can arrive any more, and the timeout timers no longer reach us.
+    m_pendingRequests.CompleteAll(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)));
+
+    // Connections still holding the context must no longer report sessions to us.
+    std::lock_guard<std::mutex> lock(m_tlsSessionLock);
+    SSL_CTX_set_app_data(m_tlsContext->native_handle(), nullptr);
+    if (m_tlsSession) {
+        SSL_SESSION_free(m_tlsSession);
+        m_tlsSession = nullptr;
     }
 }
 
 GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
+    // Only one connect runs at a time. A caller that arrives while one is running hands over its URI
+    // and waits for that connect's outcome rather than opening a competing connection.
+    std::shared_future<GenericOutcome> runningConnect;
+    {
+        std::lock_guard<std::mutex> lock(m_connectLock);
+        m_uri = uri;
+        m_uriGeneration++;
+        if (m_connecting) {
+            runningConnect = m_connectOutcome;
+        } else {
+            m_connecting = true;
+            m_connectPromise = std::promise<GenericOutcome>();
+            m_connectOutcome = m_connectPromise.get_future().share();
+        }
+    }
+
+    if (runningConnect.valid()) {
+        spdlog::info("Connection already in progress, waiting for it to finish");
+        if (runningConnect.wait_for(std::chrono::milliseconds(WAIT_FOR_CONNECT_TIMEOUT_MILLIS)) == std::future_status::timeout) {
+            spdlog::error("Connection in progress did not finish within {} ms", WAIT_FOR_CONNECT_TIMEOUT_MILLIS);
+            return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_TIMEOUT);
+        }
+        return runningConnect.get();
+    }
+
+    GenericOutcome outcome;
+    std::promise<GenericOutcome> connectPromise;
+    while (true) {
+        Uri targetUri;
+        uint64_t targetGeneration;
+        {
+            std::lock_guard<std::mutex> lock(m_connectLock);
+            targetUri = m_uri;
+            targetGeneration = m_uriGeneration;
+        }
+
+        outcome = ConnectWithRetries(targetUri);
+
+        std::lock_guard<std::mutex> lock(m_connectLock);
+        // A caller that joined with a new endpoint (a RefreshConnection, say) expects to end up on it.
+        if (outcome.IsSuccess() && targetGeneration != m_uriGeneration) {
+            spdlog::info("Connection endpoint changed while connecting, connecting again");
+            continue;
+        }
+        m_connecting = false;
+        connectPromise = std::move(m_connectPromise);
+        break;
+    }
+    connectPromise.set_value(outcome);
+    return outcome;
+}
+
+GenericOutcome WebSocketppClientWrapper::ConnectWithRetries(const Uri &uri) {
     spdlog::info("Opening Connection");
     // Perform connection with retries.
     // This attempts to start up a new websocket connection / thread
-    m_uri = uri;
     websocketpp::lib::error_code errorCode;
+    websocketpp::http::status_code::value responseCode = websocketpp::http::status_code::uninitialized;
     GeometricBackoffRetryStrategy retryStrategy;
     RetryingCallable callable = RetryingCallable::Builder()
                                     .WithRetryStrategy(&retryStrategy)
-                                    .WithCallable([this, &uri, &errorCode] {
+                                    .WithCallable([this, &uri, &errorCode, &responseCode] {
                                         spdlog::info("Attempting to perform connection");
-                                        WebSocketppClientType::connection_ptr newConnection = PerformConnect(uri, errorCode);
+                                        WebSocketppClientType::connection_ptr newConnection = PerformConnect(uri, errorCode, responseCode);
                                         if (newConnection && newConnection->get_state() == websocketpp::session::state::open) {
                                             spdlog::info("Connection established, transitioning traffic");
                                             // "Flip" traffic from our old websocket to our new websocket. Close the old one
                                             // if necessary
-                                            WebSocketppClientType::connection_ptr oldConnection = m_connection;
-                                            m_connection = newConnection;
+                                            WebSocketppClientType::connection_ptr oldConnection = ExchangeConnection(newConnection);
                                             if (oldConnection && oldConnection->get_state() == websocketpp::session::state::open) {
                                                 spdlog::info("Closing previous connection");
                                                 websocketpp::lib::error_code closeErrorCode;
                                                 m_webSocketClient->close(oldConnection->get_handle(), websocketpp::close::status::going_away,
                                                                          "Websocket client reconnecting", closeErrorCode);
-                                                if (errorCode.value()) {
+                                                if (closeErrorCode.value()) {
                                                     spdlog::warn("Failed to close old websocket after a connection refresh, ignoring.");
                                                 }
                                             }
@@ -134,11 +241,13 @@ GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
         spdlog::info("Connected to endpoint");
         return GenericOutcome(nullptr);
     } else {
+        // No other connect can have succeeded meanwhile, since connects are single-flight.
         spdlog::error("Connection to Amazon GameLift Servers websocket server failed. See error message in InitSDK() outcome for details.");
-        m_connection = nullptr;
+        ExchangeConnection(nullptr);
+        FailQueuedMessages();
         switch (errorCode.value()) {
         case websocketpp::error::server_only:
-            switch (m_fail_response_code) {
+            switch (responseCode) {
             case websocketpp::http::status_code::value::forbidden:
                 return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_FORBIDDEN);
             default:
@@ -181,9 +290,11 @@ GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
     }
 }
 
-WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(const Uri &uri, websocketpp::lib::error_code &errorCode) {
+WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(const Uri &uri, websocketpp::lib::error_code &errorCode,
+                                                                             websocketpp::http::status_code::value &responseCode) {
     spdlog::info("Performing connection");
     errorCode.clear();
+    responseCode = websocketpp::http::status_code::uninitialized;
     // Create connection request
     WebSocketppClientType::connection_ptr newConnection = m_webSocketClient->get_connection(uri.GetUriString(), errorCode);
     if (errorCode.value()) {
@@ -193,23 +304,45 @@ WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(c
         spdlog::info("Connection request created successfully. Waiting for connection to establish...");
     }
 
+    // The open and fail handlers report to this attempt only, so a handler for some other connection
+    // cannot wake us with its result.
+    std::shared_ptr<ConnectAttempt> attempt = std::make_shared<ConnectAttempt>();
+    websocketpp::connection_hdl connectionHandle = newConnection->get_handle();
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        m_connectAttempts[connectionHandle] = attempt;
+        m_connections.erase(std::remove_if(m_connections.begin(), m_connections.end(),
+                                           [](const WebSocketppClientType::connection_ptr &connection) {
+                                               return connection->get_state() == websocketpp::session::state::closed;
+                                           }),
+                            m_connections.end());
+        m_connections.push_back(newConnection);
+    }
+
     // Queue a new connection request (the socket thread will act on it and attempt to connect)
     try {
         m_webSocketClient->connect(newConnection);
     }
     catch (const std::exception& e) {
         spdlog::error("Exception while trying to connect with the webSocketClient: {}", e.what());
+        std::lock_guard<std::mutex> lk(m_lock);
+        m_connectAttempts.erase(connectionHandle);
+        errorCode = websocketpp::error::make_error_code(websocketpp::error::con_creation_failed);
+        return newConnection;
     }
     spdlog::info("Connection request queued.");
     // Wait for connection to succeed or fail (this makes connection synchronous)
     {
         std::unique_lock<std::mutex> lk(m_lock);
-        m_cond.wait(lk, [this] { return m_connectionStateChanged; });
-        spdlog::info("Connection state changed: {}", m_fail_error_code.message());
-        errorCode = m_fail_error_code;
-        // Reset
-        m_connectionStateChanged = false;
-        m_fail_error_code.clear();
+        if (!m_cond.wait_for(lk, std::chrono::milliseconds(WAIT_FOR_CONNECT_ATTEMPT_TIMEOUT_MILLIS), [&attempt] { return attempt->done; })) {
+            // If the connection does open after all, the open handler finds no attempt and closes it.
+            spdlog::error("Connection neither opened nor failed within {} ms", WAIT_FOR_CONNECT_ATTEMPT_TIMEOUT_MILLIS);
+            attempt->errorCode = websocketpp::error::make_error_code(websocketpp::error::open_handshake_timeout);
+        }
+        m_connectAttempts.erase(connectionHandle);
+        spdlog::info("Connection state changed: {}", attempt->errorCode.message());
+        errorCode = attempt->errorCode;
+        responseCode = attempt->responseCode;
     }
 
     if (errorCode.value()) {
@@ -222,69 +355,146 @@ WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(c
     return newConnection;
 }
 
-GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &requestId, const std::string &message) {
-    if (requestId.empty()) {
-        spdlog::error("Request does not have request ID, cannot process");
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
-    }
+GenericOutcome WebSocketppClientWrapper::SendSocketMessage(Message &message) {
+    // The response may be delivered after this frame is gone if we were the one to time out, so the
+    // promise is shared with the handler.
+    auto response = std::make_shared<std::promise<GenericOutcome>>();
+    std::future<GenericOutcome> responseFuture = response->get_future();
+    SendSocketMessageAsync(message, [response](const GenericOutcome &outcome) { response->set_value(outcome); });
+    return responseFuture.get();
+}
 
-    auto waitForReconnectRetryCount = 0;
-    while(!IsConnected()) {
-        // m_connection will be null if reconnect failed after max reties
-        if(m_connection == nullptr || ++waitForReconnectRetryCount >= WAIT_FOR_RECONNECT_MAX_RETRIES) {
-            spdlog::warn("WebSocket is not connected... WebSocket failed to send message due to an error.");
-            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
-        }
-        spdlog::warn("WebSocket is not connected... isConnected: {}, remoteEndpoint: {}, host: {}, port: {}",
-                IsConnected(), m_connection->get_remote_endpoint(), m_connection->get_host(), m_connection->get_port());
-        std::this_thread::sleep_for(std::chrono::seconds(WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS));
+void WebSocketppClientWrapper::SendSocketMessageAsync(Message &message, const ResponseCallback &onResponse) {
+    // m_connection will be null if the connection was closed on purpose or reconnect failed after
+    // max retries. Otherwise a closed connection is being replaced and the message is queued.
+    if (!GetConnection()) {
+        spdlog::warn("WebSocket is not connected... WebSocket failed to send message due to an error.");
+        onResponse(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)));
+        return;
     }
 
-    std::future<GenericOutcome> responseFuture;
-    // Lock whenever we make use of 'm_requestIdToPromise' to avoid concurrent writes/reads
-    {
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        // This indicates we've already sent this message, and it's still in flight
-        if (m_requestIdToPromise.count(requestId) > 0) {
-            spdlog::error("Request {} already exists", requestId);
-            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
-        }
-
-        std::promise<GenericOutcome> responsePromise;
-        responseFuture = responsePromise.get_future();
-        m_requestIdToPromise[requestId] = std::move(responsePromise);
+    // The timeout timer is cancelled by whichever completion wins. Timers are not thread safe, and
+    // completions can run on any thread, so the cancel is posted to the I/O thread that owns it.
+    asio::io_context &ioContext = GameLiftExecutor::GetInstance().GetIoContext();
+    auto timer = std::make_shared<asio::steady_timer>(ioContext);
+    PendingRequestTable::ResponseHandler onCompleted = [timer, onResponse, &ioContext](const GenericOutcome &outcome) {
+        asio::post(ioContext, [timer]() { timer->cancel(); });
+        onResponse(outcome);
+    };
+
+    // Every send (including a retry of the same message) gets a fresh slot and request ID, so a late
+    // response to an earlier attempt cannot be mistaken for this one.
+    uint32_t requestHandle;
+    if (!m_pendingRequests.Claim(requestHandle, onCompleted)) {
+        spdlog::error("Too many requests in flight ({}), cannot send {} request", PendingRequestTable::CAPACITY, message.GetAction());
+        onResponse(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::TOO_MANY_REQUESTS_EXCEPTION)));
+        return;
+    }
+    message.SetRequestId(m_pendingRequests.ToRequestId(requestHandle));
+
+    // Serialize into a buffer this thread keeps between calls, then copy once into the frame that
+    // websocketpp sends (or that waits in the queue).
+    thread_local rapidjson::StringBuffer serializeBuffer;
+    if (!message.SerializeTo(serializeBuffer)) {
+        spdlog::error("Failed to serialize {} request", message.GetAction());
+        m_pendingRequests.Cancel(requestHandle);
+        onResponse(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)));
+        return;
+    }
+    WebSocketppClientType::message_ptr frame = m_messageManager->get_message(websocketpp::frame::opcode::text, serializeBuffer.GetSize());
+    frame->set_payload(serializeBuffer.GetString(), serializeBuffer.GetSize());
+    // Keep the usual case allocation free without holding on to the occasional very large message.
+    if (serializeBuffer.GetSize() > MAX_RETAINED_SERIALIZE_BUFFER_BYTES) {
+        serializeBuffer.Clear();
+        serializeBuffer.ShrinkToFit();
     }
 
-    GenericOutcome immediateResponse = SendSocketMessageAsync(message);
+    bool queued = false;
+    GenericOutcome immediateResponse = SendOrQueueMessage(message.GetRequestId(), std::move(frame), queued);
 
     if (!immediateResponse.IsSuccess()) {
         spdlog::error("Send Socket Message immediate response failed with error {}: {}",
                       immediateResponse.GetError().GetErrorName(), immediateResponse.GetError().GetErrorMessage());
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        m_requestIdToPromise.erase(requestId);
-        return immediateResponse;
+        if (m_pendingRequests.Cancel(requestHandle)) {
+            onResponse(immediateResponse);
+        }
+        return;
     }
 
-    std::future_status promiseStatus = responseFuture.wait_for(std::chrono::milliseconds(SERVICE_CALL_TIMEOUT_MILLIS));
+    // A queued message also has to wait out the reconnect before its round trip starts. The timer
+    // holds only a weak reference: if the wrapper is destroyed first, its destructor fails the request.
+    const int timeoutMillis = queued ? WAIT_FOR_RECONNECT_TIMEOUT_MILLIS + SERVICE_CALL_TIMEOUT_MILLIS : SERVICE_CALL_TIMEOUT_MILLIS;
+    std::weak_ptr<WebSocketppClientWrapper> weakThis = weak_from_this();
+    std::string requestId = message.GetRequestId();
+    asio::post(ioContext, [timer, timeoutMillis, weakThis, requestHandle, requestId]() {
+        timer->expires_after(std::chrono::milliseconds(timeoutMillis));
+        timer->async_wait([weakThis, requestHandle, requestId, timeoutMillis](const std::error_code &errorCode) {
+            std::shared_ptr<WebSocketppClientWrapper> wrapper = weakThis.lock();
+            if (!errorCode && wrapper) {
+                wrapper->OnRequestTimeout(requestHandle, requestId, timeoutMillis);
+            }
+        });
+    });
+}
 
-    if (promiseStatus == std::future_status::timeout) {
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        spdlog::error("Response not received within the time limit of {} ms for request {}", SERVICE_CALL_TIMEOUT_MILLIS, requestId);
-        spdlog::warn("isConnected: {}, remoteEndpoint: {}, host: {}, port: {}", IsConnected(),
-                     m_connection->get_remote_endpoint(), m_connection->get_host(), m_connection->get_port());
-        m_requestIdToPromise.erase(requestId);
-        // If a call times out, retry
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE));
+void WebSocketppClientWrapper::OnRequestTimeout(uint32_t requestHandle, const std::string &requestId, int timeoutMillis) {
+    RemoveQueuedMessage(requestId);
+    // If the response won the race, the request is already complete and this does nothing. If a call
+    // times out, it is retried.
+    if (m_pendingRequests.Complete(requestHandle, GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)))) {
+        spdlog::error("Response not received within the time limit of {} ms for request {}", timeoutMillis, requestId);
+        WebSocketppClientType::connection_ptr connection = GetConnection();
+        if (connection) {
+            spdlog::warn("isConnected: {}, remoteEndpoint: {}, host: {}, port: {}", IsConnected(), connection->get_remote_endpoint(), connection->get_host(),
+                         connection->get_port());
+        }
     }
+}
 
-    return responseFuture.get();
+GenericOutcome WebSocketppClientWrapper::SendOrQueueMessage(const std::string &requestId, WebSocketppClientType::message_ptr message, bool &queued) {
+    std::lock_guard<std::mutex> lock(m_outboundLock);
+    websocketpp::lib::error_code errorCode;
+    WebSocketppClientType::connection_ptr sendConnection = m_webSocketClient->get_con_from_hdl(m_sendConnection, errorCode);
+    // Messages already waiting go out first, so only send directly when nothing is queued.
+    if (m_outboundQueue.empty() && sendConnection && sendConnection->get_state() == websocketpp::session::state::open) {
+        queued = false;
+        return WriteFrame(m_sendConnection, message);
+    }
+
+    spdlog::warn("WebSocket is not connected, queueing request {} until the connection is re-established", requestId);
+    OutboundMessage outboundMessage;
+    outboundMessage.requestId = requestId;
+    outboundMessage.payload = std::move(message);
+    m_outboundQueue.push_back(std::move(outboundMessage));
+    queued = true;
+    return GenericOutcome(nullptr);
+}
+
+void WebSocketppClientWrapper::RemoveQueuedMessage(const std::string &requestId) {
+    std::lock_guard<std::mutex> lock(m_outboundLock);
+    for (auto it = m_outboundQueue.begin(); it != m_outboundQueue.end(); ++it) {
+        if (it->requestId == requestId) {
+            m_outboundQueue.erase(it);
+            return;
+        }
+    }
 }
 
-GenericOutcome WebSocketppClientWrapper::SendSocketMessageAsync(const std::string &message) {
-    spdlog::info("Sending Socket Message, isConnected:{}, endpoint: {}, host: {}, port: {}", IsConnected(),
-                 m_connection->get_remote_endpoint(), m_connection->get_host(), m_connection->get_port());
+void WebSocketppClientWrapper::FailQueuedMessages() {
+    std::lock_guard<std::mutex> lock(m_outboundLock);
+    if (!m_outboundQueue.empty()) {
+        spdlog::warn("Failing {} queued messages, the WebSocket will not be reconnected", m_outboundQueue.size());
+    }
+    for (const OutboundMessage &outboundMessage : m_outboundQueue) {
+        m_pendingRequests.Complete(outboundMessage.requestId, GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)));
+    }
+    m_outboundQueue.clear();
+}
+
+GenericOutcome WebSocketppClientWrapper::WriteFrame(websocketpp::connection_hdl connection, WebSocketppClientType::message_ptr message) {
+    spdlog::info("Sending Socket Message, isConnected:{}", IsConnected());
     websocketpp::lib::error_code errorCode;
-    m_webSocketClient->send(m_connection->get_handle(), message.c_str(), websocketpp::frame::opcode::text, errorCode);
+    m_webSocketClient->send(connection, message, errorCode);
     if (errorCode.value()) {
         spdlog::error("Error Sending Socket Message: {}", errorCode.value());
         switch (errorCode.value()) {
@@ -302,69 +512,152 @@ GenericOutcome WebSocketppClientWrapper::SendSocketMessageAsync(const std::strin
 
 void WebSocketppClientWrapper::Disconnect() {
     spdlog::info("Disconnecting WebSocket");
-    if (m_connection != nullptr) {
+    WebSocketppClientType::connection_ptr connection = ExchangeConnection(nullptr);
+    if (connection != nullptr) {
         websocketpp::lib::error_code ec;
-        m_webSocketClient->close(m_connection->get_handle(), websocketpp::close::status::going_away, "Websocket client closing", ec);
+        m_webSocketClient->close(connection->get_handle(), websocketpp::close::status::going_away, "Websocket client closing", ec);
         if (ec) {
 	        spdlog::error("Error initiating close: {}",ec.message());
         }
-        m_connection = nullptr;
     }
+    FailQueuedMessages();
 }
 
-void WebSocketppClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) {
+void WebSocketppClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(const rapidjson::Value &)> &callback) {
     spdlog::info("Registering GameLift CallBack for: {}", gameLiftEvent);
-    m_eventHandlers[gameLiftEvent] = callback;
+    if (!m_eventHandlers.Register(gameLiftEvent, callback)) {
+        spdlog::error("No Amazon GameLift Servers event named {}, ignoring callback", gameLiftEvent);
+    }
 }
 
 bool WebSocketppClientWrapper::IsConnected() {
     // m_connection is nullptr if 'm_webSocketClient->get_connection()' fails
-    return m_connection != nullptr && m_connection->get_state() == websocketpp::session::state::open;
+    WebSocketppClientType::connection_ptr connection = GetConnection();
+    return connection != nullptr && connection->get_state() == websocketpp::session::state::open;
+}
+
+WebSocketppClientType::connection_ptr WebSocketppClientWrapper::GetConnection() {
+    std::lock_guard<std::mutex> lock(m_connectionLock);
+    return m_connection;
+}
+
+WebSocketppClientType::connection_ptr WebSocketppClientWrapper::ExchangeConnection(WebSocketppClientType::connection_ptr connection) {
+    std::lock_guard<std::mutex> lock(m_connectionLock);
+    m_connection.swap(connection);
+    return connection;
 }
 
 void WebSocketppClientWrapper::OnConnected(websocketpp::connection_hdl connection) {
     spdlog::info("Connected to WebSocket");
+    std::shared_ptr<ConnectAttempt> attempt;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        auto attemptIt = m_connectAttempts.find(connection);
+        if (attemptIt != m_connectAttempts.end()) {
+            attempt = attemptIt->second;
+        }
+    }
+    if (!attempt) {
+        spdlog::warn("Closing a connection that opened after its connect attempt gave up");
+        websocketpp::lib::error_code closeErrorCode;
+        m_webSocketClient->close(connection, websocketpp::close::status::going_away, "Websocket client connect timed out", closeErrorCode);
+        return;
+    }
+
+    // New messages go out on the newest connection. Anything written while the socket was down is
+    // sent now, in order, before Connect() has even returned.
+    {
+        std::lock_guard<std::mutex> lock(m_outboundLock);
+        m_sendConnection = connection;
+        if (!m_outboundQueue.empty()) {
+            spdlog::info("Sending {} messages queued while the WebSocket was not connected", m_outboundQueue.size());
+        }
+        while (!m_outboundQueue.empty()) {
+            const OutboundMessage &outboundMessage = m_outboundQueue.front();
+            GenericOutcome outcome = WriteFrame(connection, outboundMessage.payload);
+            if (!outcome.IsSuccess()) {
+                m_pendingRequests.Complete(outboundMessage.requestId, outcome);
+            }
+            m_outboundQueue.pop_front();
+        }
+    }
     // aquire lock and set condition variables (let main thread know connection is successful)
+    // A resumed session skips the certificate exchange; count those to show the cache is working.
+    bool resumedTlsSession = false;
+    websocketpp::lib::error_code errorCode;
+    WebSocketppClientType::connection_ptr connectionPointer = m_webSocketClient->get_con_from_hdl(connection, errorCode);
+    if (connectionPointer) {
+        resumedTlsSession = SSL_session_reused(connectionPointer->get_socket().native_handle()) == 1;
+    }
+
     {
         std::lock_guard<std::mutex> lk(m_lock);
-        // set the state change variables and notify the thread that is connecting
-        m_connectionStateChanged = true;
+        const uint64_t handshakeMicros =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - attempt->startTime).count());
+        m_connectMetrics.connectCount++;
+        if (resumedTlsSession) {
+            m_connectMetrics.resumedTlsSessionCount++;
+        }
+        m_connectMetrics.lastHandshakeMicros = handshakeMicros;
+        m_connectMetrics.totalHandshakeMicros += handshakeMicros;
+        m_connectMetrics.maxHandshakeMicros = std::max(m_connectMetrics.maxHandshakeMicros, handshakeMicros);
+        spdlog::info("WebSocket handshake completed in {} us, TLS session resumed: {}", handshakeMicros, resumedTlsSession);
+
+        // complete the attempt and notify the thread that is connecting
+        attempt->done = true;
     }
-    m_cond.notify_one();
+    m_cond.notify_all();
+}
+
+WebSocketConnectMetrics WebSocketppClientWrapper::GetConnectMetrics() {
+    std::lock_guard<std::mutex> lk(m_lock);
+    return m_connectMetrics;
 }
 
 void WebSocketppClientWrapper::OnError(websocketpp::connection_hdl connection) {
     auto con = m_webSocketClient->get_con_from_hdl(connection);
     spdlog::error("Error Connecting to WebSocket");
 
-    // aquire lock and set condition variables (let main thread know an error has occurred)
+    // aquire lock and complete this connection's attempt (let the connecting thread know an error has occurred)
     {
         std::lock_guard<std::mutex> lk(m_lock);
-        // set the state change variables and notify the thread that is connecting
-        m_connectionStateChanged = true;
-        m_fail_error_code = con->get_ec();
-        m_fail_response_code = con->get_response_code();
+        auto attemptIt = m_connectAttempts.find(connection);
+        if (attemptIt == m_connectAttempts.end()) {
+            return;
+        }
+        attemptIt->second->done = true;
+        attemptIt->second->errorCode = con->get_ec();
+        attemptIt->second->responseCode = con->get_response_code();
     }
-    m_cond.notify_one();
+    m_cond.notify_all();
 }
 
 void WebSocketppClientWrapper::OnMessage(websocketpp::connection_hdl connection, websocketpp::config::asio_client::message_type::ptr msg) {
-    std::string message = msg->get_payload();
-    spdlog::info("Received message from websocket endpoint: {}, host: {}, port: {}",
-                 m_connection->get_remote_endpoint(), m_connection->get_host(), m_connection->get_port());
+    std::string &payload = msg->get_raw_payload();
+    websocketpp::lib::error_code errorCode;
+    WebSocketppClientType::connection_ptr connectionPointer = m_webSocketClient->get_con_from_hdl(connection, errorCode);
+    if (connectionPointer) {
+        spdlog::info("Received message from websocket endpoint: {}, host: {}, port: {}",
+                     connectionPointer->get_remote_endpoint(), connectionPointer->get_host(), connectionPointer->get_port());
+    }
+    spdlog::debug("Received message payload: {}", payload);
 
-    ResponseMessage responseMessage;
-    Message &gameLiftMessage = responseMessage;
-    if (!gameLiftMessage.Deserialize(message)) {
+    // Parse the payload once, in place. The routing fields below and the event handler both read
+    // from this document, and its strings point into the payload buffer, which we own for the
+    // duration of this call. The DOM itself lives in this thread's parse arena.
+    JsonParseArena::Document document;
+    if (payload.empty() || document.ParseInsitu(&payload[0]).HasParseError() || !document.IsObject()) {
         spdlog::error("Error Deserializing Message");
         return;
     }
 
+    ResponseMessage responseMessage;
+    responseMessage.DeserializeParsed(document);
+
     const std::string &action = responseMessage.GetAction();
     spdlog::info("Deserialized Message has Action: {}", action);
     const std::string &requestId = responseMessage.GetRequestId();
     const int statusCode = responseMessage.GetStatusCode();
-    const std::string &errorMessage = responseMessage.GetErrorMessage();
 
     // Default to a success response with no result pointer
     GenericOutcome response(nullptr);
@@ -372,30 +665,69 @@ void WebSocketppClientWrapper::OnMessage(websocketpp::connection_hdl connection,
     // RequestId will be empty when we get a message not associated with a request, in which case we
     // don't expect a 200 status code either.
     if (statusCode != OK_STATUS_CODE && !requestId.empty()) {
-        response = GenericOutcome(GameLiftError(statusCode, message.c_str()));
+        // The payload was consumed by the in-situ parse, so write the document back out for the error.
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        response = GenericOutcome(GameLiftError(statusCode, buffer.GetString()));
     } else {
         // If we got a success response, and we have a special event handler for this action, invoke
         // it to get the real parsed result
-        if (m_eventHandlers.count(action)) {
+        const GameLiftEventHandlerTable::Handler *handler = m_eventHandlers.Find(action.c_str(), action.size());
+        if (handler) {
             spdlog::info("Executing Amazon GameLift Servers Event Handler for {}", action);
-            response = m_eventHandlers[action](message);
+            response = (*handler)(document);
         }
     }
 
-    // Lock whenever we make use of 'm_requestIdToPromise' to avoid concurrent writes/reads
-    std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-    if (m_requestIdToPromise.count(requestId) > 0) {
-        m_requestIdToPromise[requestId].set_value(response);
-        m_requestIdToPromise.erase(requestId);
+    // Messages pushed by the service (and responses to requests that already timed out) have no
+    // pending slot and are ignored here.
+    if (!requestId.empty()) {
+        m_pendingRequests.Complete(requestId, response);
+    }
+}
+
+websocketpp::lib::shared_ptr<asio::ssl::context> WebSocketppClientWrapper::OnTlsInit(websocketpp::connection_hdl /* hdl */) { return m_tlsContext; }
+
+void WebSocketppClientWrapper::OnSocketInit(websocketpp::connection_hdl /* hdl */, asio::ssl::stream<asio::ip::tcp::socket> &socket) {
+    // Offer the last session we were given; the server falls back to a full handshake if it no
+    // longer recognizes it.
+    std::lock_guard<std::mutex> lock(m_tlsSessionLock);
+    if (m_tlsSession) {
+        SSL_set_session(socket.native_handle(), m_tlsSession);
     }
 }
 
-websocketpp::lib::shared_ptr<asio::ssl::context> WebSocketppClientWrapper::OnTlsInit(websocketpp::connection_hdl hdl) {
-    websocketpp::lib::shared_ptr<asio::ssl::context> contextPtr(new asio::ssl::context(asio::ssl::context::tlsv12));
-    return contextPtr;
+int WebSocketppClientWrapper::OnNewTlsSession(SSL *ssl, SSL_SESSION *session) {
+    WebSocketppClientWrapper *wrapper = static_cast<WebSocketppClientWrapper *>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+    if (!wrapper) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(wrapper->m_tlsSessionLock);
+    if (wrapper->m_tlsSession) {
+        SSL_SESSION_free(wrapper->m_tlsSession);
+    }
+    // Returning 1 tells OpenSSL we took ownership of the reference.
+    wrapper->m_tlsSession = session;
+    return 1;
 }
 
 void WebSocketppClientWrapper::OnClose(websocketpp::connection_hdl connection) {
+    // Queue messages until a replacement connection opens.
+    {
+        std::lock_guard<std::mutex> lock(m_outboundLock);
+        if (!m_sendConnection.owner_before(connection) && !connection.owner_before(m_sendConnection)) {
+            m_sendConnection.reset();
+        }
+    }
+
+    // Wake the destructor if it is waiting for this connection to close.
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+    }
+    m_cond.notify_all();
+
     auto connectionPointer = m_webSocketClient->get_con_from_hdl(connection);
     auto localCloseCode = connectionPointer->get_local_close_code();
     auto remoteCloseCode = connectionPointer->get_remote_close_code();
@@ -411,7 +743,23 @@ void WebSocketppClientWrapper::OnClose(websocketpp::connection_hdl connection) {
         return;
     } else {
         spdlog::info("Abnormal Connection Closure, reconnecting.");
-        WebSocketppClientWrapper::Connect(m_uri);
+        // Connect() waits for the open handshake, which is serviced by this I/O thread, so it runs on
+        // the connection thread. Not a pool worker: those may all be senders waiting on this reconnect.
+        // Not shared_from_this(): this can run while the wrapper is being destroyed.
+        std::weak_ptr<WebSocketppClientWrapper> weakThis = weak_from_this();
+        GameLiftExecutor::GetInstance().PostConnectionTask([weakThis]() {
+            std::shared_ptr<WebSocketppClientWrapper> wrapper = weakThis.lock();
+            // A refresh or another reconnect queued ahead of this one may already have replaced the
+            // connection that closed.
+            if (wrapper && !wrapper->IsConnected()) {
+                Uri uri;
+                {
+                    std::lock_guard<std::mutex> lock(wrapper->m_connectLock);
+                    uri = wrapper->m_uri;
+                }
+                wrapper->Connect(uri);
+            }
+        });
     }
 }
 
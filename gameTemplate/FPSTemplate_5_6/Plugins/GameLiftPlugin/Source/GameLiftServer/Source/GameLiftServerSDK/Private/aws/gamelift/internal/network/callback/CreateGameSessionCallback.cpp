@@ -20,11 +20,11 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-GenericOutcome CreateGameSessionCallback::OnStartGameSession(const std::string &data) {
-    spdlog::info("OnStartGameSession Received with raw data: {}", data);
+GenericOutcome CreateGameSessionCallback::OnStartGameSession(const rapidjson::Value &data) {
+    spdlog::info("OnStartGameSession Received");
     CreateGameSessionMessage createGameSessionMessage;
     Message &message = createGameSessionMessage;
-    message.Deserialize(data);
+    message.DeserializeParsed(data);
 
     GameSession gameSession;
     gameSession.WithGameSessionId(createGameSessionMessage.GetGameSessionId().c_str())
@@ -41,7 +41,7 @@ GenericOutcome CreateGameSessionCallback::OnStartGameSession(const std::string &
         GameProperty gameProperty;
         gameProperty.SetKey(mapIterator->first.c_str());
         gameProperty.SetValue(mapIterator->second.c_str());
-        gameSession.AddGameProperty(gameProperty);
+        gameSession.AddGameProperty(std::move(gameProperty));
     }
 
     m_gameLiftMessageHandler->OnStartGameSession(gameSession);
@@ -19,11 +19,11 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome DescribePlayerSessionsCallback::OnDescribePlayerSessions(const std::string &data) {
-    spdlog::info("OnDescribePlayerSessions Received with raw data: {}", data);
+GenericOutcome DescribePlayerSessionsCallback::OnDescribePlayerSessions(const rapidjson::Value &data) {
+    spdlog::info("OnDescribePlayerSessions Received");
     WebSocketDescribePlayerSessionsResponse *describePlayerSessionsResponse = new WebSocketDescribePlayerSessionsResponse();
     Message *message = describePlayerSessionsResponse;
-    message->Deserialize(data);
+    message->DeserializeParsed(data);
 
     return GenericOutcome(describePlayerSessionsResponse);
 }
@@ -19,11 +19,11 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome GetComputeCertificateCallback::OnGetComputeCertificateCallback(const std::string &data) {
+GenericOutcome GetComputeCertificateCallback::OnGetComputeCertificateCallback(const rapidjson::Value &data) {
     spdlog::info("OnGetComputeCertificate Received");
     auto *response = new WebSocketGetComputeCertificateResponse();
     Message *message = response;
-    message->Deserialize(data);
+    message->DeserializeParsed(data);
 
     return GenericOutcome(response);
 }
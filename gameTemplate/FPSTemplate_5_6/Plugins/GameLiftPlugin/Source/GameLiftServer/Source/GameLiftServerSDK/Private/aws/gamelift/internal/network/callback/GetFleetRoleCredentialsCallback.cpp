@@ -19,11 +19,11 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials(const std::string &data) {
+GenericOutcome GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials(const rapidjson::Value &data) {
     spdlog::info("OnGetFleetRoleCredentials Received");
     auto *getFleetRoleCredentialsResponse = new WebSocketGetFleetRoleCredentialsResponse();
     Message *message = getFleetRoleCredentialsResponse;
-    message->Deserialize(data);
+    message->DeserializeParsed(data);
 
     return GenericOutcome(getFleetRoleCredentialsResponse);
 }
@@ -19,11 +19,11 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome RefreshConnectionCallback::OnRefreshConnection(const std::string &data) {
-    spdlog::info("OnRefreshConnection Received with raw data: {}", data);
+GenericOutcome RefreshConnectionCallback::OnRefreshConnection(const rapidjson::Value &data) {
+    spdlog::info("OnRefreshConnection Received");
     RefreshConnectionMessage refreshConnectionMessage;
     Message &message = refreshConnectionMessage;
-    message.Deserialize(data);
+    message.DeserializeParsed(data);
 
     m_gameLiftMessageHandler->OnRefreshConnection(refreshConnectionMessage.GetRefreshConnectionEndpoint(), refreshConnectionMessage.GetAuthToken());
 
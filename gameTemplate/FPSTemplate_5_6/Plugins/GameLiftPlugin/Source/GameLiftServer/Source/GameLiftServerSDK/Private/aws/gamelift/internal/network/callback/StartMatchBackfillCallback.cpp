@@ -19,11 +19,11 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome StartMatchBackfillCallback::OnStartMatchBackfill(const std::string &data) {
-    spdlog::info("OnStartMatchBackfill Received with raw data: {}", data);
+GenericOutcome StartMatchBackfillCallback::OnStartMatchBackfill(const rapidjson::Value &data) {
+    spdlog::info("OnStartMatchBackfill Received");
     WebSocketStartMatchBackfillResponse *startMatchBackfillResponse = new WebSocketStartMatchBackfillResponse();
     Message *message = startMatchBackfillResponse;
-    message->Deserialize(data);
+    message->DeserializeParsed(data);
 
     return GenericOutcome(startMatchBackfillResponse);
 }
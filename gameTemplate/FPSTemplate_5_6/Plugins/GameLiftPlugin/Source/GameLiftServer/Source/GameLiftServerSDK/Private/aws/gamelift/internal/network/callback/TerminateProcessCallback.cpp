@@ -20,11 +20,11 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-GenericOutcome TerminateProcessCallback::OnTerminateProcess(const std::string &data) {
-    spdlog::info("OnTerminateProcess Received with raw data: {}", data);
+GenericOutcome TerminateProcessCallback::OnTerminateProcess(const rapidjson::Value &data) {
+    spdlog::info("OnTerminateProcess Received");
     TerminateProcessMessage terminateProcessMessage;
     Message &message = terminateProcessMessage;
-    message.Deserialize(data);
+    message.DeserializeParsed(data);
 
     long terminationTime = terminateProcessMessage.GetTerminationTime();
     m_gameLiftMessageHandler->OnTerminateProcess(terminationTime);
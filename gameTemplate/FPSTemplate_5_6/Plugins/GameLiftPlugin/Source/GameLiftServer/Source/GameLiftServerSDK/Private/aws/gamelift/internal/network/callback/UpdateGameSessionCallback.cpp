@@ -20,14 +20,14 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-GenericOutcome UpdateGameSessionCallback::OnUpdateGameSession(const std::string &data) {
-    spdlog::info("OnUpdateGameSession Received with raw data: {}", data);
+GenericOutcome UpdateGameSessionCallback::OnUpdateGameSession(const rapidjson::Value &data) {
+    spdlog::info("OnUpdateGameSession Received");
     UpdateGameSessionMessage updateGameSessionMessage;
     Message &message = updateGameSessionMessage;
-    message.Deserialize(data);
+    message.DeserializeParsed(data);
 
     GameSession gameSession;
-    WebSocketGameSession webSocketGameSession = updateGameSessionMessage.GetGameSession();
+    const WebSocketGameSession &webSocketGameSession = updateGameSessionMessage.GetGameSession();
     gameSession.WithGameSessionId(webSocketGameSession.GetGameSessionId().c_str())
         .WithName(webSocketGameSession.GetName().c_str())
         .WithFleetId(webSocketGameSession.GetFleetId().c_str())
@@ -43,10 +43,10 @@ GenericOutcome UpdateGameSessionCallback::OnUpdateGameSession(const std::string
         GameProperty gameProperty;
         gameProperty.SetKey(mapIterator->first.c_str());
         gameProperty.SetValue(mapIterator->second.c_str());
-        gameSession.AddGameProperty(gameProperty);
+        gameSession.AddGameProperty(std::move(gameProperty));
     }
 
-    UpdateGameSession updateGameSession(gameSession, UpdateReasonMapper::GetUpdateReasonForName(updateGameSessionMessage.GetUpdateReason().c_str()),
+    UpdateGameSession updateGameSession(std::move(gameSession), UpdateReasonMapper::GetUpdateReasonForName(updateGameSessionMessage.GetUpdateReason().c_str()),
                                         updateGameSessionMessage.GetBackfillTicketId().c_str());
 
     m_gameLiftMessageHandler->OnUpdateGameSession(updateGameSession);
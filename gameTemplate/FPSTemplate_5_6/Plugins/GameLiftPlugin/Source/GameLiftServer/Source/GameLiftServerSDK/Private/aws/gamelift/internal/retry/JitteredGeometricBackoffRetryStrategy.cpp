@@ -11,7 +11,7 @@
  */
 
 #include <aws/gamelift/internal/retry/JitteredGeometricBackoffRetryStrategy.h>
-#include <random>
+#include <aws/gamelift/internal/util/ThreadLocalRandom.h>
 #include <thread>
 #include <spdlog/spdlog.h>
 
@@ -20,23 +20,27 @@ namespace GameLift {
 namespace Internal {
 
 void JitteredGeometricBackoffRetryStrategy::apply(const std::function<bool(void)> &callable) {
-    int retryIntervalMs = m_initialRetryIntervalMs;
-    std::random_device rd;
-    std::mt19937 randGenerator(rd());
     for (int i = 0; i < m_maxRetries; ++i) {
         bool success = callable();
         if (success) {
             break;
         } else {
-            std::uniform_int_distribution<> intervalRange(m_minRetryDelayMs, retryIntervalMs);
-            int currentInterval = intervalRange(randGenerator);
+            int currentInterval = GetRetryDelayMillis(i);
             spdlog::warn("Sending Message Failed. Retrying in {} milliseconds...", currentInterval);
             std::this_thread::sleep_for(std::chrono::milliseconds(currentInterval));
-            retryIntervalMs *= m_retryFactor;
         }
     }
 }
 
+int JitteredGeometricBackoffRetryStrategy::GetRetryDelayMillis(int attempt) const {
+    int retryIntervalMs = m_initialRetryIntervalMs;
+    for (int i = 0; i < attempt; ++i) {
+        retryIntervalMs *= m_retryFactor;
+    }
+    const uint64_t span = static_cast<uint64_t>(retryIntervalMs - m_minRetryDelayMs) + 1;
+    return m_minRetryDelayMs + static_cast<int>(ThreadLocalRandom::Next() % span);
+}
+
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
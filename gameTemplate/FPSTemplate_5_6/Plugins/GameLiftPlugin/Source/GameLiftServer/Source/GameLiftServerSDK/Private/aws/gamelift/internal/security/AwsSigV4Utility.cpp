@@ -16,7 +16,12 @@
 #include <openssl/evp.h>
 #include <openssl/sha.h>
 #include <openssl/hmac.h>
-#include <iomanip>
+#include <openssl/crypto.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L // OpenSSL 3.0 or newer
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
@@ -87,6 +92,9 @@ void AwsSigV4Utility::ValidateParameters(const SigV4Parameters &parameters) {
     }
 }
 
+std::mutex AwsSigV4Utility::s_signingKeyMutex;
+AwsSigV4Utility::SigningKeyCacheEntry AwsSigV4Utility::s_signingKeyCache;
+
 std::string AwsSigV4Utility::GenerateSignature(
         const std::string &region,
         const std::string &secretKey,
@@ -94,16 +102,53 @@ std::string AwsSigV4Utility::GenerateSignature(
         const std::string &serviceName,
         const std::string &stringToSign) {
 
-    std::vector<uint8_t> encodedKeySecret = std::vector<uint8_t>(SignatureSecretKeyPrefix, SignatureSecretKeyPrefix +
-                                                                                           strlen(SignatureSecretKeyPrefix));
-    encodedKeySecret.insert(encodedKeySecret.end(), secretKey.begin(), secretKey.end());
+    uint8_t signingKey[SHA256_DIGEST_LENGTH];
+    GetSigningKey(region, secretKey, formattedRequestDateTime, serviceName, signingKey);
 
-    auto hashDate = ComputeHmacSha256(encodedKeySecret, formattedRequestDateTime);
-    auto hashRegion = ComputeHmacSha256(hashDate, region);
-    auto hashService = ComputeHmacSha256(hashRegion, serviceName);
-    auto signingKey = ComputeHmacSha256(hashService, TerminationString);
+    uint8_t signature[SHA256_DIGEST_LENGTH];
+    ComputeHmacSha256(signingKey, sizeof(signingKey), stringToSign.data(), stringToSign.size(), signature);
+    return ToHex(signature, sizeof(signature));
+}
+
+void AwsSigV4Utility::GetSigningKey(
+        const std::string &region,
+        const std::string &secretKey,
+        const std::string &formattedRequestDate,
+        const std::string &serviceName,
+        uint8_t (&signingKey)[SHA256_DIGEST_LENGTH]) {
+
+    // The secret is only ever held as a hash in the cache.
+    uint8_t secretKeyHash[SHA256_DIGEST_LENGTH];
+    SHA256(reinterpret_cast<const unsigned char *>(secretKey.data()), secretKey.size(), secretKeyHash);
+
+    {
+        std::lock_guard<std::mutex> lock(s_signingKeyMutex);
+        if (s_signingKeyCache.Valid && s_signingKeyCache.Date == formattedRequestDate && s_signingKeyCache.Region == region &&
+            s_signingKeyCache.Service == serviceName && CRYPTO_memcmp(s_signingKeyCache.SecretKeyHash, secretKeyHash, sizeof(secretKeyHash)) == 0) {
+            memcpy(signingKey, s_signingKeyCache.SigningKey, sizeof(signingKey));
+            return;
+        }
+    }
 
-    return ToHex(ComputeHmacSha256(signingKey, stringToSign));
+    std::string encodedKeySecret = std::string(SignatureSecretKeyPrefix) + secretKey;
+
+    uint8_t hashDate[SHA256_DIGEST_LENGTH];
+    uint8_t hashRegion[SHA256_DIGEST_LENGTH];
+    uint8_t hashService[SHA256_DIGEST_LENGTH];
+    ComputeHmacSha256(reinterpret_cast<const uint8_t *>(encodedKeySecret.data()), encodedKeySecret.size(), formattedRequestDate.data(),
+                      formattedRequestDate.size(), hashDate);
+    ComputeHmacSha256(hashDate, sizeof(hashDate), region.data(), region.size(), hashRegion);
+    ComputeHmacSha256(hashRegion, sizeof(hashRegion), serviceName.data(), serviceName.size(), hashService);
+    ComputeHmacSha256(hashService, sizeof(hashService), TerminationString, strlen(TerminationString), signingKey);
+    OPENSSL_cleanse(&encodedKeySecret[0], encodedKeySecret.size());
+
+    std::lock_guard<std::mutex> lock(s_signingKeyMutex);
+    s_signingKeyCache.Valid = true;
+    s_signingKeyCache.Date = formattedRequestDate;
+    s_signingKeyCache.Region = region;
+    s_signingKeyCache.Service = serviceName;
+    memcpy(s_signingKeyCache.SecretKeyHash, secretKeyHash, sizeof(secretKeyHash));
+    memcpy(s_signingKeyCache.SigningKey, signingKey, sizeof(signingKey));
 }
 
 std::map<std::string, std::string> AwsSigV4Utility::GenerateSigV4QueryParameters(
@@ -143,44 +188,76 @@ std::string AwsSigV4Utility::ToSortedEncodedQueryString(const std::map<std::stri
 
 // Refer to documentation in AwsSigV4Utility.h
 std::string AwsSigV4Utility::ComputeSha256Hash(const std::string &data) {
-    // Because the following methods do not throw exceptions, they are not being surrounded by try-catch or use RAII for cleaning memory.
-    unsigned char hash[SHA256_DIGEST_LENGTH];
-    SHA256_CTX sha256;
-    SHA256_Init(&sha256);
-    SHA256_Update(&sha256, data.c_str(), data.size());
-    SHA256_Final(hash, &sha256);
-
-    const std::vector<uint8_t> sha256Hash = std::vector<uint8_t>(hash, hash + SHA256_DIGEST_LENGTH);
-    return ToHex(sha256Hash);
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    SHA256(reinterpret_cast<const unsigned char *>(data.data()), data.size(), hash);
+    return ToHex(hash, sizeof(hash));
 }
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L // OpenSSL 3.0 or newer
+namespace {
+// One MAC context per thread with the digest already set, re-keyed for every use. The HMAC_*
+// functions are deprecated in 3.0 and fetch the algorithm again on every init.
+struct ThreadMacContext {
+    ThreadMacContext() : Mac(EVP_MAC_fetch(nullptr, OSSL_MAC_NAME_HMAC, nullptr)), Context(Mac == nullptr ? nullptr : EVP_MAC_CTX_new(Mac)) {
+        char digest[] = OSSL_DIGEST_NAME_SHA2_256;
+        OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0), OSSL_PARAM_construct_end()};
+        if (Context != nullptr) {
+            EVP_MAC_CTX_set_params(Context, params);
+        }
+    }
+    ~ThreadMacContext() {
+        EVP_MAC_CTX_free(Context);
+        EVP_MAC_free(Mac);
+    }
+    EVP_MAC *Mac;
+    EVP_MAC_CTX *Context;
+};
+} // namespace
+#elif OPENSSL_VERSION_NUMBER >= 0x10100000L // OpenSSL 1.1.0 or newer
+namespace {
+// One HMAC context per thread, re-keyed for every use instead of allocated and freed per HMAC.
+struct ThreadHmacContext {
+    ThreadHmacContext() : Context(HMAC_CTX_new()) {}
+    ~ThreadHmacContext() { HMAC_CTX_free(Context); }
+    HMAC_CTX *Context;
+};
+} // namespace
+#endif
+
 // Refer to documentation in AwsSigV4Utility.h
-std::vector<uint8_t> AwsSigV4Utility::ComputeHmacSha256(const std::vector<uint8_t> &key, const std::string &data) {
+void AwsSigV4Utility::ComputeHmacSha256(const uint8_t *key, size_t keyLength, const char *data, size_t dataLength, uint8_t (&hash)[SHA256_DIGEST_LENGTH]) {
     // Because the following methods do not throw exceptions, they are not being surrounded by try-catch or use RAII for cleaning memory.
-    unsigned char hash[EVP_MAX_MD_SIZE];
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L // OpenSSL 3.0 or newer
+    static thread_local ThreadMacContext threadContext;
+    EVP_MAC_CTX *ctx = threadContext.Context;
+    size_t len = 0;
+    EVP_MAC_init(ctx, key, keyLength, nullptr);
+    EVP_MAC_update(ctx, reinterpret_cast<const unsigned char *>(data), dataLength);
+    EVP_MAC_final(ctx, hash, &len, SHA256_DIGEST_LENGTH);
+#elif OPENSSL_VERSION_NUMBER >= 0x10100000L // OpenSSL 1.1.0 or newer
     unsigned int len = 0;
-
-#if OPENSSL_VERSION_NUMBER >= 0x10100000L // OpenSSL 1.1.0 or newer
-    HMAC_CTX *ctx = HMAC_CTX_new();
-    HMAC_Init_ex(ctx, key.data(), key.size(), EVP_sha256(), nullptr);
-    HMAC_Update(ctx, reinterpret_cast<const unsigned char *>(data.c_str()), data.size());
+    static thread_local ThreadHmacContext threadContext;
+    HMAC_CTX *ctx = threadContext.Context;
+    HMAC_Init_ex(ctx, key, static_cast<int>(keyLength), EVP_sha256(), nullptr);
+    HMAC_Update(ctx, reinterpret_cast<const unsigned char *>(data), dataLength);
     HMAC_Final(ctx, hash, &len);
-    HMAC_CTX_free(ctx);
 #else // Older versions of OpenSSL
+    unsigned int len = 0;
     HMAC_CTX ctx;
     HMAC_CTX_init(&ctx);
-    HMAC_Init_ex(&ctx, key.data(), key.size(), EVP_sha256(), nullptr);
-    HMAC_Update(&ctx, reinterpret_cast<const unsigned char *>(data.c_str()), data.size());
+    HMAC_Init_ex(&ctx, key, static_cast<int>(keyLength), EVP_sha256(), nullptr);
+    HMAC_Update(&ctx, reinterpret_cast<const unsigned char *>(data), dataLength);
     HMAC_Final(&ctx, hash, &len);
     HMAC_CTX_cleanup(&ctx);
 #endif
-    return std::vector<uint8_t>(hash, hash + len);
 }
 
-std::string AwsSigV4Utility::ToHex(const std::vector<uint8_t> &hashBytes) {
-    std::ostringstream stringBuffer;
-    for (auto b: hashBytes) {
-        stringBuffer << std::hex << std::setw(2) << std::setfill('0') << (int) b;
+std::string AwsSigV4Utility::ToHex(const uint8_t *bytes, size_t length) {
+    static constexpr char HexDigits[] = "0123456789abcdef";
+    std::string hex(length * 2, '\0');
+    for (size_t i = 0; i < length; i++) {
+        hex[2 * i] = HexDigits[bytes[i] >> 4];
+        hex[2 * i + 1] = HexDigits[bytes[i] & 0x0f];
     }
-    return stringBuffer.str();
+    return hex;
 }
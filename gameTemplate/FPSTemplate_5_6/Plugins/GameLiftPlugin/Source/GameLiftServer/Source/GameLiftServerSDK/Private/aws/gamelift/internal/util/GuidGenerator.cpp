@@ -11,37 +11,41 @@
  */
 
 #include <aws/gamelift/internal/util/GuidGenerator.h>
-#include <iostream>
+#include <aws/gamelift/internal/util/ThreadLocalRandom.h>
+#include <cstdint>
 #include <string>
-#include <random>
-#include <sstream>
-#include <iomanip>
 
 using namespace Aws::GameLift::Internal;
 
-std::string GuidGenerator::GenerateGuid() {
-    std::random_device rd;
-    std::uniform_int_distribution<int> dist(0, 15);
-    std::uniform_int_distribution<int> dist2(8, 11);
-
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-
-    for (int i = 0; i < 8; ++i) ss << dist(rd);
-    ss << "-";
-
-    for (int i = 0; i < 4; ++i) ss << dist(rd);
-    ss << "-";
-
-    ss << "4";
-    for (int i = 0; i < 3; ++i) ss << dist(rd);
-    ss << "-";
-
-    ss << dist2(rd);
-    for (int i = 0; i < 3; ++i) ss << dist(rd);
-    ss << "-";
+namespace {
+const char HEX_DIGITS[] = "0123456789abcdef";
+}
 
-    for (int i = 0; i < 12; ++i) ss << dist(rd);
+void GuidGenerator::GenerateGuid(char (&buffer)[GUID_LENGTH + 1]) {
+    uint8_t bytes[16];
+    const uint64_t high = ThreadLocalRandom::Next();
+    const uint64_t low = ThreadLocalRandom::Next();
+    for (int i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<uint8_t>(high >> (8 * i));
+        bytes[i + 8] = static_cast<uint8_t>(low >> (8 * i));
+    }
+    // Version 4 in the high nibble of byte 6, RFC 4122 variant (8-b) in the high bits of byte 8.
+    bytes[6] = static_cast<uint8_t>((bytes[6] & 0x0F) | 0x40);
+    bytes[8] = static_cast<uint8_t>((bytes[8] & 0x3F) | 0x80);
+
+    char *out = buffer;
+    for (int i = 0; i < 16; ++i) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) {
+            *out++ = '-';
+        }
+        *out++ = HEX_DIGITS[bytes[i] >> 4];
+        *out++ = HEX_DIGITS[bytes[i] & 0x0F];
+    }
+    *out = '\0';
+}
 
-    return ss.str();
+std::string GuidGenerator::GenerateGuid() {
+    char buffer[GUID_LENGTH + 1];
+    GenerateGuid(buffer);
+    return std::string(buffer, GUID_LENGTH);
 }
@@ -13,45 +13,13 @@
 
 using namespace Aws::GameLift::Internal;
 
-std::string JsonHelper::SafelyDeserializeString(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsString() ? value[key].GetString() : "";
-}
-
-void JsonHelper::WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const std::string &value) {
-    if (!value.empty()) {
-        writer->String(key);
-        writer->String(value.c_str());
-    }
-}
-
-int JsonHelper::SafelyDeserializeInt(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsInt() ? value[key].GetInt() : -1;
-}
-
-void JsonHelper::WritePositiveInt(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int value) {
-    if (value > 0) {
-        writer->String(key);
-        writer->Int(value);
-    }
-}
-
-int64_t JsonHelper::SafelyDeserializeInt64(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsInt64() ? value[key].GetInt64() : -1;
-}
-
-void JsonHelper::WritePositiveInt64(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int64_t value) {
-    if (value > 0) {
-        writer->String(key);
-        writer->Int64(value);
-    }
-}
-
 Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(const rapidjson::Value &value, const char *key) {
-    if (!value.HasMember(key) || !value[key].IsArray() || value[key].Size() == 0) {
+    const rapidjson::Value *logPathsValue = FindMember(value, key);
+    if (!logPathsValue || !logPathsValue->IsArray() || logPathsValue->Size() == 0) {
         return Aws::GameLift::Server::LogParameters();
     }
 
-    const rapidjson::SizeType numLogPaths = value[key].Size();
+    const rapidjson::SizeType numLogPaths = logPathsValue->Size();
 #ifdef GAMELIFT_USE_STD
     std::vector<std::string> logPaths = std::vector<std::string>();
 #else
@@ -59,15 +27,15 @@ Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(
 #endif
 
     for (rapidjson::SizeType i = 0; i < numLogPaths; i++) {
-        if (value[key][i].IsString()) {
+        if ((*logPathsValue)[i].IsString()) {
 #ifdef GAMELIFT_USE_STD
-            logPaths.push_back(value[key][i].GetString());
+            logPaths.push_back((*logPathsValue)[i].GetString());
 #else
             logPaths[i] = new char[MAX_PATH_LENGTH];
 #ifdef WIN32
-            strcpy_s(logPaths[i], MAX_PATH_LENGTH, value[key][i].GetString());
+            strcpy_s(logPaths[i], MAX_PATH_LENGTH, (*logPathsValue)[i].GetString());
 #else
-            strncpy(logPaths[i], value[key][i].GetString(), MAX_PATH_LENGTH);
+            strncpy(logPaths[i], (*logPathsValue)[i].GetString(), MAX_PATH_LENGTH);
 #endif
 #endif
         }
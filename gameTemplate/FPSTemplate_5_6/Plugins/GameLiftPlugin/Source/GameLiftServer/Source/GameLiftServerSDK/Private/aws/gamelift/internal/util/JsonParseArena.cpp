@@ -0,0 +1,41 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/util/JsonParseArena.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+JsonParseArena::JsonParseArena() : m_allocator(m_buffer, BUFFER_BYTES), m_documentCount(0) {}
+
+JsonParseArena &JsonParseArena::ForCurrentThread() {
+    thread_local JsonParseArena arena;
+    return arena;
+}
+
+JsonParseArena::Document::Document()
+    : DocumentType(&ForCurrentThread().m_allocator, PARSE_STACK_BYTES, &ForCurrentThread().m_allocator), m_arena(ForCurrentThread()) {
+    m_arena.m_documentCount++;
+}
+
+JsonParseArena::Document::~Document() {
+    // Documents can nest (a handler may parse while its message is still alive), so only the
+    // outermost one gives the memory back. Anything that spilled past the buffer is freed here.
+    if (--m_arena.m_documentCount == 0) {
+        m_arena.m_allocator.Clear();
+    }
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
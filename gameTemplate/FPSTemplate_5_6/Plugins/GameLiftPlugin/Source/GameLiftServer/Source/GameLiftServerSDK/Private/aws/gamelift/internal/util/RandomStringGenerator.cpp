@@ -11,30 +11,46 @@
  */
 
 #include <aws/gamelift/internal/util/RandomStringGenerator.h>
-#include <random>
-#include <sstream>
+#include <aws/gamelift/internal/util/ThreadLocalRandom.h>
+#include <cstdint>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-std::string RandomStringGenerator::GenerateRandomAlphaNumericString(const int stringLength) {
-    std::stringstream ss;
-    static const char alphaNumChars[] = "0123456789"
-                                        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                        "abcdefghijklmnopqrstuvwxyz";
-    static thread_local std::mt19937 randomNumberGenerator(std::random_device{}());
-    // Distribution has an inclusive upper bound. "alphaNumChars" will end in a null terminator, so
-    // we use "sizeof() - 2" to avoid out of bounds errors, and also to avoid including the null
-    // terminator.
-    std::uniform_int_distribution<int> distribution(0, sizeof(alphaNumChars) - 2);
+namespace {
+const char ALPHA_NUM_CHARS[] = "0123456789"
+                               "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                               "abcdefghijklmnopqrstuvwxyz";
+// "ALPHA_NUM_CHARS" ends in a null terminator, which must never be picked.
+const uint64_t ALPHA_NUM_COUNT = sizeof(ALPHA_NUM_CHARS) - 1;
+
+// Maps 32 random bits onto [0, ALPHA_NUM_COUNT) with a multiply and shift rather than a modulo or a
+// rejection loop. The bias this leaves is below one part in 2^26.
+inline char ToAlphaNum(uint32_t bits) { return ALPHA_NUM_CHARS[(static_cast<uint64_t>(bits) * ALPHA_NUM_COUNT) >> 32]; }
+} // namespace
 
-    for (int i = 0; i < stringLength; i++) {
-        ss << alphaNumChars[distribution(randomNumberGenerator)];
+void RandomStringGenerator::GenerateRandomAlphaNumericString(char *buffer, std::size_t length) {
+    std::size_t i = 0;
+    for (; i + 1 < length; i += 2) {
+        const uint64_t bits = ThreadLocalRandom::Next();
+        buffer[i] = ToAlphaNum(static_cast<uint32_t>(bits));
+        buffer[i + 1] = ToAlphaNum(static_cast<uint32_t>(bits >> 32));
+    }
+    if (i < length) {
+        buffer[i] = ToAlphaNum(static_cast<uint32_t>(ThreadLocalRandom::Next()));
+    }
+}
+
+std::string RandomStringGenerator::GenerateRandomAlphaNumericString(const int stringLength) {
+    if (stringLength <= 0) {
+        return std::string();
     }
-    return ss.str();
+    std::string result(static_cast<std::size_t>(stringLength), '\0');
+    GenerateRandomAlphaNumericString(&result[0], result.size());
+    return result;
 }
 
 } // namespace Internal
 } // namespace GameLift
-} // namespace Aws
\ No newline at end of file
+} // namespace Aws
@@ -0,0 +1,74 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/util/ThreadLocalRandom.h>
+#include <atomic>
+#include <chrono>
+#include <random>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+uint64_t SplitMix64(uint64_t &state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t ProcessSeed() {
+    static const uint64_t seed = [] {
+        std::random_device rd;
+        const uint64_t entropy = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+        // Some standard libraries implement random_device deterministically; mix in the clock as well.
+        return entropy ^ static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    }();
+    return seed;
+}
+
+inline uint64_t RotateLeft(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+struct Xoshiro256StarStar {
+    Xoshiro256StarStar() {
+        static std::atomic<uint64_t> threadCounter(0);
+        uint64_t seed = ProcessSeed() + threadCounter.fetch_add(1, std::memory_order_relaxed) * 0xD1B54A32D192ED03ULL;
+        for (uint64_t &word : s) {
+            word = SplitMix64(seed);
+        }
+    }
+
+    uint64_t Next() {
+        const uint64_t result = RotateLeft(s[1] * 5, 7) * 9;
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = RotateLeft(s[3], 45);
+        return result;
+    }
+
+    uint64_t s[4];
+};
+} // namespace
+
+uint64_t ThreadLocalRandom::Next() {
+    static thread_local Xoshiro256StarStar generator;
+    return generator.Next();
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
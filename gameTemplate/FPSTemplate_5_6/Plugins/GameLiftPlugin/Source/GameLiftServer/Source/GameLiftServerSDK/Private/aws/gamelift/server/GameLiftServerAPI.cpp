@@ -375,3 +375,186 @@ GetFleetRoleCredentialsOutcome Server::GetFleetRoleCredentials(const Aws::GameLi
 
     return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::NOT_INITIALIZED));
 }
+
+
+GenericOutcomeCallable Server::ProcessReadyAsync(const Aws::GameLift::Server::ProcessParameters &processParameters, const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    return serverState->ProcessReadyAsync(processParameters, callback);
+}
+
+GenericOutcomeCallable Server::ProcessEndingAsync(const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    return serverState->ProcessEndingAsync(callback);
+}
+
+GenericOutcomeCallable Server::ActivateGameSessionAsync(const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    return serverState->ActivateGameSessionAsync(callback);
+}
+
+GenericOutcomeCallable Server::UpdatePlayerSessionCreationPolicyAsync(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                                       const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    return serverState->UpdatePlayerSessionCreationPolicyAsync(newPlayerSessionPolicy, callback);
+}
+
+#ifdef GAMELIFT_USE_STD
+GenericOutcomeCallable Server::AcceptPlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), callback);
+    }
+
+    return serverState->AcceptPlayerSessionAsync(playerSessionId, callback);
+}
+
+GenericOutcomeCallable Server::RemovePlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), callback);
+    }
+
+    return serverState->RemovePlayerSessionAsync(playerSessionId, callback);
+}
+#else
+GenericOutcomeCallable Server::AcceptPlayerSessionAsync(const char *playerSessionId, const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), callback);
+    }
+
+    return serverState->AcceptPlayerSessionAsync(std::string(playerSessionId), callback);
+}
+
+GenericOutcomeCallable Server::RemovePlayerSessionAsync(const char *playerSessionId, const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), callback);
+    }
+
+    return serverState->RemovePlayerSessionAsync(std::string(playerSessionId), callback);
+}
+#endif
+
+DescribePlayerSessionsOutcomeCallable Server::DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                                                          const DescribePlayerSessionsOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(DescribePlayerSessionsOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        return Internal::GameLiftServerState::CompletedAsync(DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), callback);
+    }
+
+    return serverState->DescribePlayerSessionsAsync(describePlayerSessionsRequest, callback);
+}
+
+StartMatchBackfillOutcomeCallable Server::StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &request,
+                                                                  const StartMatchBackfillOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(StartMatchBackfillOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    return serverState->StartMatchBackfillAsync(request, callback);
+}
+
+GenericOutcomeCallable Server::StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &request, const GenericOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GenericOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    return serverState->StopMatchBackfillAsync(request, callback);
+}
+
+GetComputeCertificateOutcomeCallable Server::GetComputeCertificateAsync(const GetComputeCertificateOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GetComputeCertificateOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    return serverState->GetComputeCertificateAsync(callback);
+}
+
+GetFleetRoleCredentialsOutcomeCallable Server::GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                                                            const GetFleetRoleCredentialsOutcomeCallback &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return Internal::GameLiftServerState::CompletedAsync(GetFleetRoleCredentialsOutcome(giOutcome.GetError()), callback);
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    return serverState->GetFleetRoleCredentialsAsync(request, callback);
+}
\ No newline at end of file
@@ -32,6 +32,13 @@ DECLARE_DELEGATE_OneParam(FOnStartGameSession, Aws::GameLift::Server::Model::Gam
 DECLARE_DELEGATE_OneParam(FOnUpdateGameSession, Aws::GameLift::Server::Model::UpdateGameSession);
 DECLARE_DELEGATE_RetVal(bool, FOnHealthCheck);
 
+// Completion callbacks for the *Async module calls. These are always invoked on the game thread.
+typedef TFunction<void(FGameLiftGenericOutcome)> FGameLiftGenericOutcomeCallback;
+typedef TFunction<void(FGameLiftStringOutcome)> FGameLiftStringOutcomeCallback;
+typedef TFunction<void(FGameLiftDescribePlayerSessionsOutcome)> FGameLiftDescribePlayerSessionsOutcomeCallback;
+typedef TFunction<void(FGameLiftGetComputeCertificateOutcome)> FGameLiftGetComputeCertificateOutcomeCallback;
+typedef TFunction<void(FGameLiftGetFleetRoleCredentialsOutcome)> FGameLiftGetFleetRoleCredentialsOutcomeCallback;
+
 struct GAMELIFTSERVERSDK_API FProcessParameters {
     FOnStartGameSession OnStartGameSession;
     FOnUpdateGameSession OnUpdateGameSession;
@@ -52,11 +59,11 @@ struct GAMELIFTSERVERSDK_API FProcessParameters {
     }
 
     void OnActivateFunction(Aws::GameLift::Server::Model::GameSession gameSession) {
-        this->OnStartGameSession.ExecuteIfBound(gameSession);
+        this->OnStartGameSession.ExecuteIfBound(MoveTemp(gameSession));
     }
 
     void OnUpdateFunction(Aws::GameLift::Server::Model::UpdateGameSession updateGameSession) {
-        this->OnUpdateGameSession.ExecuteIfBound(updateGameSession);
+        this->OnUpdateGameSession.ExecuteIfBound(MoveTemp(updateGameSession));
     }
 };
 
@@ -84,6 +91,34 @@ struct GAMELIFTSERVERSDK_API FPlayer {
     TMap<FString, int32> m_latencyInMs;
 };
 
+struct GAMELIFTSERVERSDK_API FGameLiftMatchmakerTeam {
+    FString m_name;
+    TArray<FPlayer> m_players;
+};
+
+// Parsed form of a game session's MatchmakerData JSON. It is built once on the SDK callback thread
+// when a session starts or is updated and never modified afterwards, so readers share it without locking.
+struct GAMELIFTSERVERSDK_API FGameLiftMatchmakerData {
+    FString m_matchId;
+    FString m_matchmakingConfigurationArn;
+    FString m_autoBackfillMode;
+    FString m_autoBackfillTicketId;
+    TArray<FGameLiftMatchmakerTeam> m_teams;
+    // Player ID -> (team index, player index) into m_teams.
+    TMap<FString, TPair<int32, int32>> m_playerIndex;
+
+    const FPlayer* FindPlayer(const FString& playerId) const {
+        const TPair<int32, int32>* index = m_playerIndex.Find(playerId);
+        return index ? &m_teams[index->Key].m_players[index->Value] : nullptr;
+    }
+
+    int32 GetPlayerCount() const {
+        return m_playerIndex.Num();
+    }
+};
+
+typedef TSharedPtr<const FGameLiftMatchmakerData, ESPMode::ThreadSafe> FGameLiftMatchmakerDataPtr;
+
 struct GAMELIFTSERVERSDK_API FStartMatchBackfillRequest {
     FString m_ticketId;
     FString m_gameSessionArn;
@@ -147,6 +182,24 @@ public:
     virtual FGameLiftGetComputeCertificateOutcome GetComputeCertificate();
     virtual FGameLiftGetFleetRoleCredentialsOutcome GetFleetRoleCredentials(const FGameLiftGetFleetRoleCredentialsRequest& request);
 
+    // Matchmaker data of the current game session, parsed when OnStartGameSession/OnUpdateGameSession fired.
+    // Null when the session was not created by FlexMatch. Safe to call from any thread.
+    virtual FGameLiftMatchmakerDataPtr GetMatchmakerData() const;
+
+    // Non-blocking variants of the calls above. The service round trip happens on an SDK worker thread
+    // and OnComplete is marshalled back to the game thread, so no frame waits on the network.
+    virtual void ProcessReadyAsync(FProcessParameters &processParameters, FGameLiftGenericOutcomeCallback OnComplete);
+    virtual void ProcessEndingAsync(FGameLiftGenericOutcomeCallback OnComplete);
+    virtual void ActivateGameSessionAsync(FGameLiftGenericOutcomeCallback OnComplete);
+    virtual void AcceptPlayerSessionAsync(const FString& playerSessionId, FGameLiftGenericOutcomeCallback OnComplete);
+    virtual void RemovePlayerSessionAsync(const FString& playerSessionId, FGameLiftGenericOutcomeCallback OnComplete);
+    virtual void DescribePlayerSessionsAsync(const FGameLiftDescribePlayerSessionsRequest& describePlayerSessionsRequest, FGameLiftDescribePlayerSessionsOutcomeCallback OnComplete);
+    virtual void UpdatePlayerSessionCreationPolicyAsync(EPlayerSessionCreationPolicy policy, FGameLiftGenericOutcomeCallback OnComplete);
+    virtual void StartMatchBackfillAsync(const FStartMatchBackfillRequest& request, FGameLiftStringOutcomeCallback OnComplete);
+    virtual void StopMatchBackfillAsync(const FStopMatchBackfillRequest& request, FGameLiftGenericOutcomeCallback OnComplete);
+    virtual void GetComputeCertificateAsync(FGameLiftGetComputeCertificateOutcomeCallback OnComplete);
+    virtual void GetFleetRoleCredentialsAsync(const FGameLiftGetFleetRoleCredentialsRequest& request, FGameLiftGetFleetRoleCredentialsOutcomeCallback OnComplete);
+
 private:
     /** Handle to the dll we will load */
     static void* GameLiftServerSDKLibraryHandle;
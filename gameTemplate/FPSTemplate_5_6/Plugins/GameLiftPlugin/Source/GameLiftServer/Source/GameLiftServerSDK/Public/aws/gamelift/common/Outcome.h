@@ -15,6 +15,7 @@
 #include <aws/gamelift/server/model/GetComputeCertificateResult.h>
 #include <aws/gamelift/server/model/GetFleetRoleCredentialsResult.h>
 #include <aws/gamelift/server/model/StartMatchBackfillResult.h>
+#include <functional>
 #include <future>
 
 namespace Aws {
@@ -81,7 +82,6 @@ private:
 };
 
 typedef Outcome<void *, GameLiftError> GenericOutcome;
-typedef std::future<GenericOutcome> GenericOutcomeCallable;
 typedef Outcome<std::string, GameLiftError> AwsStringOutcome;
 typedef Outcome<long, GameLiftError> AwsLongOutcome;
 #else
@@ -125,5 +125,22 @@ typedef Outcome<Aws::GameLift::Server::Model::DescribePlayerSessionsResult, Game
 typedef Outcome<Aws::GameLift::Server::Model::StartMatchBackfillResult, GameLiftError> StartMatchBackfillOutcome;
 typedef Outcome<Aws::GameLift::Server::Model::GetComputeCertificateResult, GameLiftError> GetComputeCertificateOutcome;
 typedef Outcome<Aws::GameLift::Server::Model::GetFleetRoleCredentialsResult, GameLiftError> GetFleetRoleCredentialsOutcome;
+
+/**
+ * Futures returned by the *Async variants of the server API. They are fulfilled on the SDK's worker
+ * thread once the service call completes; the matching callback (if any) runs on that same thread
+ * just before the future becomes ready.
+ */
+typedef std::future<GenericOutcome> GenericOutcomeCallable;
+typedef std::future<DescribePlayerSessionsOutcome> DescribePlayerSessionsOutcomeCallable;
+typedef std::future<StartMatchBackfillOutcome> StartMatchBackfillOutcomeCallable;
+typedef std::future<GetComputeCertificateOutcome> GetComputeCertificateOutcomeCallable;
+typedef std::future<GetFleetRoleCredentialsOutcome> GetFleetRoleCredentialsOutcomeCallable;
+
+typedef std::function<void(const GenericOutcome &)> GenericOutcomeCallback;
+typedef std::function<void(const DescribePlayerSessionsOutcome &)> DescribePlayerSessionsOutcomeCallback;
+typedef std::function<void(const StartMatchBackfillOutcome &)> StartMatchBackfillOutcomeCallback;
+typedef std::function<void(const GetComputeCertificateOutcome &)> GetComputeCertificateOutcomeCallback;
+typedef std::function<void(const GetFleetRoleCredentialsOutcome &)> GetFleetRoleCredentialsOutcomeCallback;
 } // namespace GameLift
 } // namespace Aws
@@ -12,7 +12,9 @@
 #pragma once
 
 #include <aws/gamelift/internal/GameLiftCommonState.h>
+#include <aws/gamelift/internal/network/GameLiftExecutor.h>
 #include <aws/gamelift/internal/network/GameLiftWebSocketClientManager.h>
+#include <aws/gamelift/internal/network/HeartbeatScheduler.h>
 #include <aws/gamelift/internal/network/IGameLiftMessageHandler.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
 #include <aws/gamelift/internal/network/callback/CreateGameSessionCallback.h>
@@ -28,8 +30,12 @@
 #include <aws/gamelift/server/model/StartMatchBackfillRequest.h>
 #include <aws/gamelift/server/model/StopMatchBackfillRequest.h>
 #include <aws/gamelift/server/model/UpdateGameSession.h>
+#include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <future>
 #include <mutex>
+#include <thread>
 
 namespace Aws {
 namespace GameLift {
@@ -57,12 +63,14 @@ private:
     static constexpr const char *ENV_VAR_SESSION_TOKEN = "GAMELIFT_SESSION_TOKEN";
     static constexpr const char *ENV_VAR_SDK_TOOL_NAME = "GAMELIFT_SDK_TOOL_NAME";
     static constexpr const char *ENV_VAR_SDK_TOOL_VERSION = "GAMELIFT_SDK_TOOL_VERSION";
+    static constexpr const char *ENV_VAR_MAX_IN_FLIGHT_REQUESTS = "GAMELIFT_SDK_MAX_IN_FLIGHT_REQUESTS";
+    static constexpr const char *ENV_VAR_HEALTHCHECK_INTERVAL_MILLIS = "GAMELIFT_SDK_HEALTHCHECK_INTERVAL_MILLIS";
     static constexpr const char *COMPUTE_TYPE_CONTAINER = "CONTAINER";
     static constexpr const char *AGENTLESS_CONTAINER_PROCESS_ID = "ManagedResource";
 
     static constexpr const int HEALTHCHECK_INTERVAL_MILLIS = 60 * 1000;
     static constexpr const int HEALTHCHECK_MAX_JITTER_MILLIS = 10 * 1000;
-    static constexpr const int HEALTHCHECK_TIMEOUT_MILLIS = HEALTHCHECK_INTERVAL_MILLIS - HEALTHCHECK_MAX_JITTER_MILLIS;
+    static constexpr const int HEALTHCHECK_MIN_INTERVAL_MILLIS = 1000;
 
     void GetOverrideParams(char **webSocketUrl,
                            char **authToken,
@@ -78,9 +86,13 @@ private:
                            char *accessKey,
                            char *secretKey,
                            char *sessionToken);
-    void ReportHealth();
-    void HealthCheck();
-    int GetNextHealthCheckIntervalMillis();
+    int GetMaxInFlightRequests();
+    int GetHealthCheckIntervalMillis();
+    // Wraps the registered health callback for the heartbeat scheduler.
+    void StartHealthCheck();
+    void StartHeartbeatScheduler(const HeartbeatScheduler::HealthProbe &probe);
+    // Starts the heartbeat send and returns; the outcome is only logged.
+    void ReportHealth(bool healthy);
 
 #ifdef GAMELIFT_USE_STD
 public:
@@ -210,19 +222,140 @@ public:
     // When within 15 minutes of expiration we retrieve new instance role credentials
     static constexpr const time_t INSTANCE_ROLE_CREDENTIAL_TTL_MIN = 60 * 15;
 
+    /**
+     * Per-action request counters (count, failures, time queued for a window slot and round-trip
+     * time) accumulated since InitSDK.
+     */
+    std::map<std::string, RequestWindow::ActionLatency> GetRequestLatencies() const;
+
+    /**
+     * Websocket connection counters: connects, TLS session resumptions and handshake time.
+     */
+    WebSocketConnectMetrics GetConnectMetrics() const;
+
+    // Non-blocking variants of the service calls above, which are built on them. The request is
+    // sent from the calling thread and completed from the response handler, so no thread waits on
+    // it. The optional callback is invoked on the SDK worker pool and then the returned future is
+    // set; without one the future is set straight from the response handler.
+    GenericOutcomeCallable ProcessReadyAsync(const Aws::GameLift::Server::ProcessParameters &processParameters, const GenericOutcomeCallback &callback);
+
+    GenericOutcomeCallable ProcessEndingAsync(const GenericOutcomeCallback &callback);
+
+    GenericOutcomeCallable ActivateGameSessionAsync(const GenericOutcomeCallback &callback);
+
+    GenericOutcomeCallable UpdatePlayerSessionCreationPolicyAsync(PlayerSessionCreationPolicy newPlayerSessionPolicy, const GenericOutcomeCallback &callback);
+
+    GenericOutcomeCallable AcceptPlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback);
+
+    GenericOutcomeCallable RemovePlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback);
+
+    DescribePlayerSessionsOutcomeCallable DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                                                      const DescribePlayerSessionsOutcomeCallback &callback);
+
+    StartMatchBackfillOutcomeCallable StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &request,
+                                                              const StartMatchBackfillOutcomeCallback &callback);
+
+    GenericOutcomeCallable StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &request, const GenericOutcomeCallback &callback);
+
+    GetComputeCertificateOutcomeCallable GetComputeCertificateAsync(const GetComputeCertificateOutcomeCallback &callback);
+
+    GetFleetRoleCredentialsOutcomeCallable GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                                                        const GetFleetRoleCredentialsOutcomeCallback &callback);
+
+    /**
+     * Returns an already-satisfied future for an outcome that was decided without a service call
+     * (e.g. a failed precondition), invoking the callback inline so callers see one code path.
+     */
+    template <typename OutcomeT>
+    static std::future<OutcomeT> CompletedAsync(const OutcomeT &outcome, const std::function<void(const OutcomeT &)> &callback) {
+        if (callback) {
+            callback(outcome);
+        }
+        std::promise<OutcomeT> promise;
+        promise.set_value(outcome);
+        return promise.get_future();
+    }
+
 private:
     bool AssertNetworkInitialized();
     void SetUpCallbacks();
 
-    bool m_processReady;
+    // Stores the developer callbacks from ProcessReady.
+    void SetProcessCallbacks(const Aws::GameLift::Server::ProcessParameters &processParameters);
+
+    std::string CopyGameSessionId() const;
+
+    // A message being sent with retries. Lives until its response callback has run.
+    struct RetryingSend;
+
+    /**
+     * Sends the message with the same retries and reconnects as SendSocketMessageWithRetries, without
+     * blocking: backoff delays are timers on the I/O thread and reconnects run on the connection
+     * thread. onResponse runs once, on whichever thread finished the send, and must not block.
+     */
+    void SendSocketMessageWithRetriesAsync(std::shared_ptr<Message> message, const IWebSocketClientWrapper::ResponseCallback &onResponse);
+    void SendAttempt(const std::shared_ptr<RetryingSend> &send);
+    void OnSendAttempt(const std::shared_ptr<RetryingSend> &send, const GenericOutcome &outcome);
+    void RetrySend(const std::shared_ptr<RetryingSend> &send, int failedAttempt, const GenericOutcome &outcome);
+    void FinishSend(const std::shared_ptr<RetryingSend> &send, GenericOutcome outcome);
+
+    /**
+     * Sends request and completes the returned future with onResponse's conversion of the response.
+     * onResponse runs on the thread that delivered the response and must not block.
+     */
+    template <typename OutcomeT>
+    std::future<OutcomeT> SendAsync(std::shared_ptr<Message> request, std::function<OutcomeT(const GenericOutcome &)> onResponse,
+                                    std::function<void(const OutcomeT &)> callback) {
+        auto promise = std::make_shared<std::promise<OutcomeT>>();
+        std::future<OutcomeT> future = promise->get_future();
+        SendSocketMessageWithRetriesAsync(request, [onResponse, callback, promise](const GenericOutcome &response) {
+            CompleteAsync<OutcomeT>(onResponse(response), callback, promise);
+        });
+        return future;
+    }
+
+    // onResponse for calls whose outcome is the service response itself.
+    static GenericOutcome ReturnResponse(const GenericOutcome &response) { return response; }
+
+    template <typename OutcomeT>
+    static void CompleteAsync(const OutcomeT &outcome, const std::function<void(const OutcomeT &)> &callback, const std::shared_ptr<std::promise<OutcomeT>> &promise) {
+        if (!callback) {
+            promise->set_value(outcome);
+            return;
+        }
+        // The callback may block or call back into the SDK, so it never runs on the thread that
+        // delivered the response.
+        GameLiftExecutor::GetInstance().Post([outcome, callback, promise]() {
+            callback(outcome);
+            promise->set_value(outcome);
+        });
+    }
+
+    /**
+     * Runs a connect or reconnect on the executor's connection thread, then onConnected (if any) on
+     * that thread. Counted with the async calls, so the destructor waits for it too.
+     */
+    void DispatchReconnect(std::function<GenericOutcome()> connect, IWebSocketClientWrapper::ResponseCallback onConnected);
+
+    // The destructor waits for every call between these to finish before tearing down networking.
+    void BeginAsyncCall();
+    void EndAsyncCall();
+    void WaitForAsyncCalls();
+
+    // Set from the response handler and service messages on the I/O thread, read by callers on any
+    // thread.
+    std::atomic<bool> m_processReady;
 
     // Only one game session per process.
+    mutable std::mutex m_gameSessionIdMutex;
     std::string m_gameSessionId;
 
-    long m_terminationTime;
+    std::atomic<long> m_terminationTime;
 
     GameLiftWebSocketClientManager *m_webSocketClientManager;
     std::shared_ptr<IWebSocketClientWrapper> m_webSocketClientWrapper;
+    // Shared by every client manager so the in-flight limit and latency counters span reconnects.
+    std::shared_ptr<RequestWindow> m_requestWindow;
 
     // Callbacks
     std::unique_ptr<CreateGameSessionCallback> m_createGameSessionCallback;
@@ -240,13 +373,20 @@ private:
     std::string m_hostId;
     std::string m_processId;
     // Assume we're on managed EC2, if GetFleetRoleCredentials fails we know to set this to false
-    bool m_onManagedEC2OrContainers = true;
+    std::atomic<bool> m_onManagedEC2OrContainers{true};
     std::map<std::string, GetFleetRoleCredentialsResult> m_instanceRoleResultCache;
+    std::mutex m_instanceRoleResultCacheMutex;
+
+    std::unique_ptr<HeartbeatScheduler> m_heartbeatScheduler;
+
+    // Start and update game session callbacks run in the order the service sent them.
+    GameLiftExecutor::Strand m_gameSessionCallbackStrand = GameLiftExecutor::GetInstance().MakeStrand();
+
+    std::mutex m_asyncCallMutex;
+    std::condition_variable m_asyncCallConditionVariable;
+    int m_asyncCallsInFlight = 0;
 
-    std::unique_ptr<std::thread> m_healthCheckThread;
-    std::condition_variable m_healthCheckConditionVariable;
-    std::mutex m_healthCheckMutex;
-    bool m_healthCheckInterrupted;
+    static constexpr const int MAX_SEND_FAILURES_BEFORE_RECONNECT = 2;
 };
 
 } // namespace Internal
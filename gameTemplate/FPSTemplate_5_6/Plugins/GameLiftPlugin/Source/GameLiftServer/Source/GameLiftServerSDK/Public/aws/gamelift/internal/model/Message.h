@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/ISerializable.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <iostream>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
@@ -27,13 +28,13 @@ namespace Internal {
 /**
  * Base Message class representing a message that is sent to and from the Amazon GameLift Servers WebSocket. All
  * messages have a request ID, which represents the following:
- * - For outgoing messages: A randomly generated ID
+ * - For outgoing messages: An ID assigned by the websocket client when the message is sent
  * - For incoming messages: The ID of the outgoing message which triggered the incoming
  * messages/response
  */
 class Message : public ISerializable {
 public:
-    Message() : m_requestId(Message::GenerateRandomRequestId()) {}
+    Message() = default;
     Message(const Message &) = default;
     Message(Message &&) = default;
     Message &operator=(const Message &) = default;
@@ -63,11 +64,23 @@ public:
      */
     std::string Serialize() const override;
 
+    /**
+     * Serialize the Message into Json, replacing the contents of the given buffer. Lets callers that
+     * send many messages reuse one buffer instead of allocating a string per message.
+     */
+    bool SerializeTo(rapidjson::StringBuffer &buffer) const;
+
     /**
      * Deserialize the given json string and populate the member variables.
      */
     bool Deserialize(const std::string &jsonString) override;
 
+    /**
+     * Populate the member variables from an already parsed json value, so a message that has been
+     * parsed once for routing does not need to be parsed again by its handler.
+     */
+    bool DeserializeParsed(const rapidjson::Value &value) { return Deserialize(value); }
+
     friend std::ostream &operator<<(std::ostream &os, const Message &message);
 
 protected:
@@ -89,10 +102,10 @@ private:
     static constexpr const char *ACTION = "Action";
     static constexpr const char *REQUEST_ID = "RequestId";
 
+    static const JsonSchema<Message>::Field FIELDS[];
+
     std::string m_action;
     std::string m_requestId;
-
-    static std::string GenerateRandomRequestId();
 };
 
 } // namespace Internal
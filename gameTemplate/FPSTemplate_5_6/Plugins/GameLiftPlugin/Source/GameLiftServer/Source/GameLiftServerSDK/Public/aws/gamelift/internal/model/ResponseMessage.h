@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <iostream>
 
 namespace Aws {
@@ -64,6 +65,8 @@ private:
     static constexpr const char *STATUS_CODE = "StatusCode";
     static constexpr const char *ERROR_MESSAGE = "ErrorMessage";
 
+    static const JsonSchema<ResponseMessage>::Field FIELDS[];
+
     int m_statusCode;
     std::string m_errorMessage;
 };
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <aws/gamelift/server/model/AttributeValue.h>
 #include <map>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
@@ -113,6 +114,12 @@ public:
     bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
     bool Deserialize(const rapidjson::Value &value);
 
+    /**
+     * Writes a public model attribute value in the same shape as Serialize, without first converting
+     * it into a WebSocketAttributeValue.
+     */
+    static void SerializeFrom(rapidjson::Writer<rapidjson::StringBuffer> *writer, const Server::Model::AttributeValue &value);
+
 private:
     static constexpr const char *ATTR_TYPE = "AttrType";
     static constexpr const char *S = "S";
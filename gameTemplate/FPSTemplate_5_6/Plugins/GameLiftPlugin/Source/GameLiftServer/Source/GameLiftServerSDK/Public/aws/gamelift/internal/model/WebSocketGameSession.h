@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <iostream>
 #include <map>
 #include <rapidjson/document.h>
@@ -146,6 +147,8 @@ private:
     static constexpr const char *GAME_PROPERTIES = "GameProperties";
     static constexpr const char *DNS_NAME = "DnsName";
 
+    static const JsonSchema<WebSocketGameSession>::Field FIELDS[];
+
     std::string m_gameSessionId;
     std::string m_name;
     std::string m_fleetId;
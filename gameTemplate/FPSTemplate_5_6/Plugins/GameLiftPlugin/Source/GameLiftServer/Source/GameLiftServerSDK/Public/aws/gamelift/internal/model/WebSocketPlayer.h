@@ -12,6 +12,8 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/WebSocketAttributeValue.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
+#include <aws/gamelift/server/model/Player.h>
 #include <map>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
@@ -73,12 +75,20 @@ public:
     bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
     bool Deserialize(const rapidjson::Value &value);
 
+    /**
+     * Writes a public model player in the same shape as Serialize, without first converting it (and
+     * every attribute) into a WebSocketPlayer.
+     */
+    static void SerializeFrom(rapidjson::Writer<rapidjson::StringBuffer> *writer, const Server::Model::Player &player);
+
 private:
     static constexpr const char *PLAYER_ID = "PlayerId";
     static constexpr const char *PLAYER_ATTRIBUTES = "PlayerAttributes";
     static constexpr const char *LATENCY_IN_MS = "LatencyInMs";
     static constexpr const char *TEAM = "Team";
 
+    static const JsonSchema<WebSocketPlayer>::Field FIELDS[];
+
     std::string m_playerId;
     std::map<std::string, WebSocketAttributeValue> m_playerAttributes;
     std::map<std::string, int> m_latencyInMs;
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/WebSocketPlayerSessionStatus.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/rapidjson.h>
@@ -162,6 +163,8 @@ private:
     static constexpr const char *PLAYER_DATA = "PlayerData";
     static constexpr const char *DNS_NAME = "DnsName";
 
+    static const JsonSchema<WebSocketPlayerSession>::Field FIELDS[];
+
     std::string m_playerSessionId;
     std::string m_playerId;
     std::string m_gameSessionId;
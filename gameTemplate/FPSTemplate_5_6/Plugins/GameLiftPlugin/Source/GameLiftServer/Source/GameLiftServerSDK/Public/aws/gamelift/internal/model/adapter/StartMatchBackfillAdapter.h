@@ -19,6 +19,7 @@
 #include <aws/gamelift/server/model/StartMatchBackfillRequest.h>
 #include <aws/gamelift/server/model/StartMatchBackfillResult.h>
 #include <cstring>
+#include <memory>
 
 namespace Aws {
 namespace GameLift {
@@ -26,11 +27,8 @@ namespace Internal {
 class StartMatchBackfillAdapter {
 public:
     static Server::Model::StartMatchBackfillResult convert(const WebSocketStartMatchBackfillResponse *webSocketResponse);
-    static WebSocketStartMatchBackfillRequest convert(const Server::Model::StartMatchBackfillRequest &request);
-    static std::map<std::string, int> fetchAndConvertLatency(const Server::Model::Player &player);
-    static std::map<std::string, WebSocketAttributeValue> fetchAndConvertAttributes(const Server::Model::Player &player);
-    static std::vector<std::string> convertStringList(const Server::Model::AttributeValue &attributeValue);
-    static std::map<std::string, double> convertStringDoubleMap(const Server::Model::AttributeValue &attributeValue);
+    // The returned request shares ownership of request and streams its players from it.
+    static WebSocketStartMatchBackfillRequest convert(const std::shared_ptr<const Server::Model::StartMatchBackfillRequest> &request);
 };
 } // namespace Internal
 } // namespace GameLift
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <iostream>
 #include <map>
 #include <string>
@@ -132,6 +133,8 @@ private:
     static constexpr const char *PORT = "Port";
     static constexpr const char *GAME_PROPERTIES = "GameProperties";
 
+    static const JsonSchema<CreateGameSessionMessage>::Field FIELDS[];
+
     std::string m_gameSessionId;
     std::string m_gameSessionName;
     std::string m_gameSessionData;
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <iostream>
 
 namespace Aws {
@@ -56,6 +57,8 @@ private:
     static constexpr const char *REFRESH_CONNECTION_ENDPOINT = "RefreshConnectionEndpoint";
     static constexpr const char *AUTH_TOKEN = "AuthToken";
 
+    static const JsonSchema<RefreshConnectionMessage>::Field FIELDS[];
+
     std::string m_refreshConnectionEndpoint;
     std::string m_authToken;
 };
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <iostream>
 
 namespace Aws {
@@ -50,6 +51,8 @@ private:
     static constexpr const char *TERMINATE_PROCESS = "TerminateProcess";
     static constexpr const char *TERMINATION_TIME = "TerminationTime";
 
+    static const JsonSchema<TerminateProcessMessage>::Field FIELDS[];
+
     long m_terminationTime;
 };
 
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <aws/gamelift/internal/model/WebSocketGameSession.h>
 
 namespace Aws {
@@ -70,6 +71,8 @@ private:
     static constexpr const char *UPDATE_REASON = "UpdateReason";
     static constexpr const char *BACKFILL_TICKET_ID = "BackfillTicketId";
 
+    static const JsonSchema<UpdateGameSessionMessage>::Field FIELDS[];
+
     WebSocketGameSession m_gameSession;
     std::string m_updateReason;
     std::string m_backfillTicketId;
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 
 namespace Aws {
 namespace GameLift {
@@ -52,6 +53,8 @@ private:
     static constexpr const char *ACTIVATE_GAME_SESSION = "ActivateGameSession";
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
 
+    static const JsonSchema<ActivateGameSessionRequest>::Field FIELDS[];
+
     std::string m_gameSessionId;
 };
 
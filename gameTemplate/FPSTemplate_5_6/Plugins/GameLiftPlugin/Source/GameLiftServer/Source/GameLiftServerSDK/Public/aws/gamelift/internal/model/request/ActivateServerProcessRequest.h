@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <aws/gamelift/server/LogParameters.h>
 
 namespace Aws {
@@ -103,6 +104,8 @@ private:
     static constexpr const char *PORT = "Port";
     static constexpr const char *LOG_PATHS = "LogPaths";
 
+    static const JsonSchema<ActivateServerProcessRequest>::Field FIELDS[];
+
     std::string m_sdkVersion;
     std::string m_sdkLanguage;
     std::string m_sdkToolName;
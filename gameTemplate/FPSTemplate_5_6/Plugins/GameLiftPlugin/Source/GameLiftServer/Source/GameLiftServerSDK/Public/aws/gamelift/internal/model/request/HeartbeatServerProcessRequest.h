@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <iostream>
 
 namespace Aws {
@@ -50,6 +51,8 @@ private:
     static constexpr const char *HEARTBEAT_SERVER_PROCESS = "HeartbeatServerProcess";
     static constexpr const char *HEALTH_STATUS = "HealthStatus";
 
+    static const JsonSchema<HeartbeatServerProcessRequest>::Field FIELDS[];
+
     bool m_healthy;
 };
 
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 
 #include <utility>
 
@@ -62,6 +63,8 @@ private:
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
     static constexpr const char *PLAYER_SESSION_ID = "PlayerSessionId";
 
+    static const JsonSchema<RemovePlayerSessionRequest>::Field FIELDS[];
+
     std::string m_gameSessionId;
     std::string m_playerSessionId;
 };
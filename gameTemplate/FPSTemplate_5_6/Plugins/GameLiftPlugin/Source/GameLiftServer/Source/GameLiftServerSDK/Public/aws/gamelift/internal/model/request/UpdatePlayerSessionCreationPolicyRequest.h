@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 
 namespace Aws {
 namespace GameLift {
@@ -100,6 +101,8 @@ private:
     static constexpr const char *DENY_ALL = "DENY_ALL";
     static constexpr const char *NOT_SET = "NOT_SET";
 
+    static const JsonSchema<UpdatePlayerSessionCreationPolicyRequest>::Field FIELDS[];
+
     std::string m_gameSessionId;
     WebSocketPlayerSessionCreationPolicy m_playerSessionCreationPolicy = WebSocketPlayerSessionCreationPolicy::NOT_SET;
 };
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 
 namespace Aws {
 namespace GameLift {
@@ -100,6 +101,8 @@ private:
     static constexpr const char *NEXT_TOKEN = "NextToken";
     static constexpr const char *LIMIT = "Limit";
 
+    static const JsonSchema<WebSocketDescribePlayerSessionsRequest>::Field FIELDS[];
+
     std::string m_gameSessionId;
     std::string m_playerId;
     std::string m_playerSessionId;
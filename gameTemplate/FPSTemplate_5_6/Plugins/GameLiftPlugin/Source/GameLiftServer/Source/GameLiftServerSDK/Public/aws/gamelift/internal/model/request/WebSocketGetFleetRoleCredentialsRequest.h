@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 
 namespace Aws {
 namespace GameLift {
@@ -60,6 +61,8 @@ private:
     static constexpr const char *ROLE_ARN = "RoleArn";
     static constexpr const char *ROLE_SESSION_NAME = "RoleSessionName";
 
+    static const JsonSchema<WebSocketGetFleetRoleCredentialsRequest>::Field FIELDS[];
+
     std::string m_roleArn;
     std::string m_roleSessionName;
 };
@@ -13,7 +13,10 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <aws/gamelift/internal/model/WebSocketPlayer.h>
+#include <aws/gamelift/server/model/StartMatchBackfillRequest.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -69,6 +72,16 @@ public:
         return *this;
     }
 
+    /**
+     * Serialize the players straight from the caller's request instead of from a converted copy. The
+     * message shares ownership of the request, so retries and re-sends after a reconnect can serialize
+     * it again after the caller has returned. Takes precedence over players set through SetPlayers.
+     */
+    inline WebSocketStartMatchBackfillRequest &WithPlayersFrom(const std::shared_ptr<const Server::Model::StartMatchBackfillRequest> &playersSource) {
+        m_playersSource = playersSource;
+        return *this;
+    }
+
     friend std::ostream &operator<<(std::ostream &os, const WebSocketStartMatchBackfillRequest &describePlayerSessionsRequest);
 
 protected:
@@ -83,10 +96,13 @@ private:
     static constexpr const char *MATCHMAKING_CONFIGURATION_ARN = "MatchmakingConfigurationArn";
     static constexpr const char *PLAYERS = "Players";
 
+    static const JsonSchema<WebSocketStartMatchBackfillRequest>::Field FIELDS[];
+
     std::string m_ticketId;
     std::string m_gameSessionArn;
     std::string m_matchmakingConfigurationArn;
     std::vector<WebSocketPlayer> m_players;
+    std::shared_ptr<const Server::Model::StartMatchBackfillRequest> m_playersSource;
 };
 } // namespace Internal
 } // namespace GameLift
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <iostream>
 
 namespace Aws {
@@ -64,6 +65,8 @@ private:
     static constexpr const char *MATCHMAKING_CONFIG_ARN = "MatchmakingConfigurationArn";
     static constexpr const char *TICKET_ID = "TicketId";
 
+    static const JsonSchema<WebSocketStopMatchBackfillRequest>::Field FIELDS[];
+
     std::string m_gameSessionArn;
     std::string m_matchmakingConfigurationArn;
     std::string m_ticketId;
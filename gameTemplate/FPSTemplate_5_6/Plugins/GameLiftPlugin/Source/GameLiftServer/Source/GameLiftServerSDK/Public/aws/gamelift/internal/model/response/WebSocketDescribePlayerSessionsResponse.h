@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <aws/gamelift/internal/model/WebSocketPlayerSession.h>
 #include <vector>
 
@@ -62,6 +63,8 @@ private:
     static constexpr const char *PLAYER_SESSIONS = "PlayerSessions";
     static constexpr const char *NEXT_TOKEN = "NextToken";
 
+    static const JsonSchema<WebSocketDescribePlayerSessionsResponse>::Field FIELDS[];
+
     std::vector<WebSocketPlayerSession> m_playerSessions;
     std::string m_nextToken;
 };
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <vector>
 
 namespace Aws {
@@ -61,6 +62,8 @@ private:
     static constexpr const char *COMPUTE_NAME = "ComputeName";
     static constexpr const char *CERTIFICATE_PATH = "CertificatePath";
 
+    static const JsonSchema<WebSocketGetComputeCertificateResponse>::Field FIELDS[];
+
     std::string m_computeName;
     std::string m_certificatePath;
 };
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 
 namespace Aws {
 namespace GameLift {
@@ -100,6 +101,8 @@ private:
     static constexpr const char *SESSION_TOKEN = "SessionToken";
     static constexpr const char *EXPIRATION = "Expiration";
 
+    static const JsonSchema<WebSocketGetFleetRoleCredentialsResponse>::Field FIELDS[];
+
     std::string m_assumedRoleUserArn;
     std::string m_assumedRoleId;
     std::string m_accessKeyId;
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonSchema.h>
 #include <aws/gamelift/internal/model/WebSocketPlayerSession.h>
 #include <vector>
 
@@ -52,6 +53,8 @@ private:
 
     static constexpr const char *TICKET_ID = "TicketId";
 
+    static const JsonSchema<WebSocketStartMatchBackfillResponse>::Field FIELDS[];
+
     std::string m_ticketId;
 };
 } // namespace Internal
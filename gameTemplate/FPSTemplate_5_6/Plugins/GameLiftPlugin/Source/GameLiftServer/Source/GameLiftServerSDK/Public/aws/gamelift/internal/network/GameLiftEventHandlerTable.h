@@ -0,0 +1,58 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/common/Outcome.h>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <rapidjson/document.h>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Handlers for the actions that arrive on the Amazon GameLift Servers websocket, looked up by a
+ * perfect hash of the action name. The set of actions is fixed at compile time, so a lookup is one
+ * hash, one array index and one string compare.
+ */
+class GameLiftEventHandlerTable {
+public:
+    typedef std::function<GenericOutcome(const rapidjson::Value &)> Handler;
+
+    /**
+     * Registers the handler for an action. Returns false if the action is not one the table knows.
+     */
+    bool Register(const std::string &action, const Handler &handler);
+
+    /**
+     * Returns the handler for the action, or nullptr if none is registered.
+     */
+    const Handler *Find(const char *action, std::size_t length) const;
+
+private:
+    static constexpr const int TABLE_SIZE = 16;
+
+    struct Entry {
+        const char *action = nullptr;
+        std::size_t length = 0;
+        Handler handler;
+    };
+
+    std::array<Entry, TABLE_SIZE> m_entries;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,92 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#endif
+#include <asio/executor_work_guard.hpp>
+#include <asio/io_context.hpp>
+#include <asio/post.hpp>
+#include <asio/strand.hpp>
+#include <asio/thread_pool.hpp>
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#include <functional>
+#include <thread>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Process-wide executor that every SDK thread of control runs on.
+ *
+ * - One io_context, serviced by a single I/O thread, drives the websocket. Handlers running on it
+ *   must never block on a response, since the same thread has to read that response.
+ * - A small fixed worker pool runs everything that may block, chiefly developer callbacks and
+ *   health probes. API calls and heartbeat reports never wait on the pool: they complete from
+ *   the response handler. Work that must stay ordered is posted to a strand of the pool.
+ * - A connection thread of its own runs connects and reconnects. Senders on the pool can be
+ *   blocked waiting for a reconnect, so the reconnect must never need a pool worker to run.
+ *
+ * The executor is created on first use and intentionally never destroyed, so a task is free to
+ * Destroy() the SDK (or exit the process) without joining the thread it is running on.
+ */
+class GameLiftExecutor {
+public:
+    typedef asio::strand<asio::thread_pool::executor_type> Strand;
+
+    static constexpr const int WORKER_THREAD_COUNT = 4;
+
+    static GameLiftExecutor &GetInstance();
+
+    asio::io_context &GetIoContext() { return m_ioContext; }
+
+    bool IsIoThread() const { return std::this_thread::get_id() == m_ioThread.get_id(); }
+
+    /**
+     * Creates a strand on the worker pool. Tasks posted to the same strand run one at a time, in the
+     * order they were posted.
+     */
+    Strand MakeStrand() { return asio::make_strand(m_workers); }
+
+    void Post(std::function<void()> task);
+
+    void Post(const Strand &strand, std::function<void()> task);
+
+    /**
+     * Runs the task on the connection thread. Tasks run one at a time, in the order they were posted.
+     */
+    void PostConnectionTask(std::function<void()> task);
+
+private:
+    GameLiftExecutor();
+    GameLiftExecutor(const GameLiftExecutor &) = delete;
+    GameLiftExecutor &operator=(const GameLiftExecutor &) = delete;
+
+    static void RunTask(const std::function<void()> &task);
+    void RunIoContext();
+
+    asio::io_context m_ioContext;
+    // Keeps the I/O thread running while there are no connections.
+    asio::executor_work_guard<asio::io_context::executor_type> m_ioWorkGuard;
+    asio::thread_pool m_workers;
+    asio::thread_pool m_connectionWorker;
+    std::thread m_ioThread;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
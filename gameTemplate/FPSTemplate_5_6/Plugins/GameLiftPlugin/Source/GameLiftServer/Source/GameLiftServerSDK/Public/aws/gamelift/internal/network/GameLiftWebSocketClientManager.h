@@ -15,6 +15,7 @@
 #include <aws/gamelift/internal/model/Message.h>
 #include <aws/gamelift/internal/model/Uri.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/network/RequestWindow.h>
 #include <future>
 #include <mutex>
 
@@ -28,7 +29,9 @@ namespace Internal {
  */
 class GameLiftWebSocketClientManager {
 public:
-    GameLiftWebSocketClientManager(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper) : m_webSocketClientWrapper(webSocketClientWrapper) {}
+    GameLiftWebSocketClientManager(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper,
+                                   std::shared_ptr<RequestWindow> requestWindow = std::make_shared<RequestWindow>())
+        : m_webSocketClientWrapper(webSocketClientWrapper), m_requestWindow(requestWindow) {}
 
     ~GameLiftWebSocketClientManager() = default;
 
@@ -36,8 +39,12 @@ public:
 
     Aws::GameLift::GenericOutcome Connect(std::string websocketUrl, const std::string &authToken, const std::string &processId, const std::string &hostId,
                                           const std::string &fleetId, const std::map<std::string, std::string> &sigV4QueryParameters = {});
-    // Messages are synchronously sent and a response is waited for.
+    // Messages are synchronously sent and a response is waited for. Concurrent callers share the
+    // connection up to the request window's limit; beyond it they wait for a slot to free up.
     GenericOutcome SendSocketMessage(Message &message);
+    // As above without blocking: onResponse runs once the response (or failure) is in, possibly on
+    // the socket thread, so it must not block. message must stay alive until then.
+    void SendSocketMessageAsync(Message &message, const IWebSocketClientWrapper::ResponseCallback &onResponse);
     void Disconnect();
 
 private:
@@ -55,6 +62,7 @@ private:
 
     // The WebSocketClient that this class is managing.
     std::shared_ptr<IWebSocketClientWrapper> m_webSocketClientWrapper;
+    std::shared_ptr<RequestWindow> m_requestWindow;
 };
 } // namespace Internal
 } // namespace GameLift
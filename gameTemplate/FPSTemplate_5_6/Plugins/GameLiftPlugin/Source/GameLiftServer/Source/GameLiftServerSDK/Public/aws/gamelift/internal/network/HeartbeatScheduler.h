@@ -0,0 +1,66 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/internal/network/GameLiftExecutor.h>
+#include <functional>
+#include <memory>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Drives the periodic process heartbeat from a timer on the SDK I/O thread, so no thread sleeps
+ * between beats and none is created per beat.
+ *
+ * On every beat the health probe runs on its own strand of the worker pool. Whichever comes first,
+ * the probe returning or the probe deadline expiring, produces the health value handed to the
+ * reporter; a probe that overruns is reported as unhealthy and its late result is dropped. The
+ * reporter runs on the probe strand or the I/O thread and must not block: it starts the report
+ * and returns, and the send completes asynchronously.
+ */
+class HeartbeatScheduler {
+public:
+    typedef std::function<bool()> HealthProbe;
+    typedef std::function<void(bool healthy)> HealthReporter;
+
+    HeartbeatScheduler(HealthProbe probe, HealthReporter reporter, int intervalMillis, int maxJitterMillis, int probeTimeoutMillis);
+
+    // Stops the scheduler; see Stop().
+    ~HeartbeatScheduler();
+
+    /**
+     * Sends the first heartbeat right away, then one every interval +/- jitter. Does nothing if
+     * already started.
+     */
+    void Start();
+
+    /**
+     * Cancels the pending beat immediately rather than at the next wake-up. No report is started
+     * after Stop() returns; one already started still completes. Must not be called from the
+     * reporter.
+     */
+    void Stop();
+
+private:
+    HeartbeatScheduler(const HeartbeatScheduler &) = delete;
+    HeartbeatScheduler &operator=(const HeartbeatScheduler &) = delete;
+
+    struct State;
+    // Shared with pending timer and probe handlers, which may still be queued after Stop().
+    std::shared_ptr<State> m_state;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -11,7 +11,9 @@
  */
 #pragma once
 #include <aws/gamelift/common/Outcome.h>
+#include <aws/gamelift/internal/model/Message.h>
 #include <aws/gamelift/internal/model/Uri.h>
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -19,16 +21,34 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+/**
+ * Counters for websocket connections opened since the client was created. Handshake time runs from
+ * queuing the connection to the websocket being open, so it covers the TCP, TLS and HTTP upgrade.
+ */
+struct WebSocketConnectMetrics {
+    uint64_t connectCount = 0;
+    uint64_t resumedTlsSessionCount = 0;
+    uint64_t lastHandshakeMicros = 0;
+    uint64_t totalHandshakeMicros = 0;
+    uint64_t maxHandshakeMicros = 0;
+};
+
 /**
  * Interface for a class that wraps a websocket implementation.
  */
 class IWebSocketClientWrapper {
 public:
+    typedef std::function<void(const GenericOutcome &)> ResponseCallback;
+
     virtual Aws::GameLift::GenericOutcome Connect(const Uri &uri) = 0;
-    virtual Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const std::string &message) = 0;
+    virtual Aws::GameLift::GenericOutcome SendSocketMessage(Message &message) = 0;
+    // Sends without waiting. onResponse runs exactly once: with the response (on the socket thread),
+    // on timeout, or on the calling thread if the message could not be sent at all. It must not block.
+    virtual void SendSocketMessageAsync(Message &message, const ResponseCallback &onResponse) = 0;
     virtual void Disconnect() = 0;
-    virtual void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) = 0;
+    virtual void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(const rapidjson::Value &)> &callback) = 0;
     virtual bool IsConnected() = 0;
+    virtual WebSocketConnectMetrics GetConnectMetrics() { return WebSocketConnectMetrics(); }
 
     virtual ~IWebSocketClientWrapper() = default;
 };
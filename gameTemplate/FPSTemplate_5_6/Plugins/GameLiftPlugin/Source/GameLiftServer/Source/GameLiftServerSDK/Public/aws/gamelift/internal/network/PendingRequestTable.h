@@ -0,0 +1,118 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/common/Outcome.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Fixed-capacity table of requests awaiting a response from the Amazon GameLift Servers websocket.
+ *
+ * Each outstanding request owns one slot, identified by a handle that packs the slot index with the
+ * slot's generation. The generation is bumped every time a slot is released, so a late response for
+ * a request that already timed out can never complete whichever request reuses the slot. Slots are
+ * claimed, completed and cancelled with a single compare-and-swap on the slot state; no lock is
+ * shared between the sending threads and the socket thread delivering responses.
+ *
+ * The handle is sent to the service as the message's request ID: a short per-table prefix followed
+ * by the handle in hex (e.g. "aZ3k9Q0004a1f2"). The service echoes it back on the response, so
+ * looking a response up is a parse and an array index.
+ *
+ * Every claimed slot is resolved exactly once: its handler runs with the response, or with the
+ * failure passed to the timeout or shutdown path, whichever gets there first. Handlers run on the
+ * completing thread after the slot is released, so they may claim another slot.
+ */
+class PendingRequestTable {
+public:
+    typedef std::function<void(const GenericOutcome &)> ResponseHandler;
+
+    static constexpr const int INDEX_BITS = 8;
+    static constexpr const int CAPACITY = 1 << INDEX_BITS; // 256 requests in flight
+    static constexpr const int REQUEST_ID_PREFIX_LENGTH = 6;
+
+    PendingRequestTable();
+
+    /**
+     * Claims a free slot for a new request. On success, handle identifies the slot and onResponse
+     * runs once the request is completed. Returns false if every slot is in use.
+     */
+    bool Claim(uint32_t &handle, ResponseHandler onResponse);
+
+    /**
+     * Delivers the response for the request with the given wire request ID. Returns false if the ID
+     * was not issued by this table, or the request was already completed or cancelled.
+     */
+    bool Complete(const std::string &requestId, const GenericOutcome &response);
+
+    /**
+     * Completes the request in the given slot with outcome, e.g. a timeout. Returns false if it was
+     * already completed or cancelled.
+     */
+    bool Complete(uint32_t handle, const GenericOutcome &outcome);
+
+    /**
+     * Releases a slot without running its handler, for a request that was never sent. Returns false
+     * if the request was already completed.
+     */
+    bool Cancel(uint32_t handle);
+
+    /**
+     * Completes every outstanding request with outcome. Used when the connection owning the table
+     * goes away, so no caller is left waiting on a response that cannot arrive.
+     */
+    void CompleteAll(const GenericOutcome &outcome);
+
+    /**
+     * Formats a handle as the request ID sent on the wire. Fits in the small string buffer, so it does
+     * not allocate.
+     */
+    std::string ToRequestId(uint32_t handle) const;
+
+private:
+    static constexpr const uint32_t INDEX_MASK = CAPACITY - 1;
+    static constexpr const int GENERATION_BITS = 32 - INDEX_BITS;
+    static constexpr const uint32_t GENERATION_MASK = (1u << GENERATION_BITS) - 1;
+    static constexpr const int STATUS_BITS = 2;
+    static constexpr const uint32_t STATUS_MASK = (1u << STATUS_BITS) - 1;
+    static constexpr const int HANDLE_HEX_DIGITS = 8;
+
+    // Slot state is (generation << STATUS_BITS) | status.
+    static constexpr const uint32_t STATUS_FREE = 0;
+    static constexpr const uint32_t STATUS_PENDING = 1;
+    // Held briefly by the one thread setting up or taking the slot's handler.
+    static constexpr const uint32_t STATUS_BUSY = 2;
+
+    struct Slot {
+        std::atomic<uint32_t> state{STATUS_FREE};
+        ResponseHandler onResponse;
+    };
+
+    static uint32_t ReleasedState(uint32_t generation) { return (((generation + 1) & GENERATION_MASK) << STATUS_BITS) | STATUS_FREE; }
+
+    bool ParseRequestId(const std::string &requestId, uint32_t &handle) const;
+
+    std::array<Slot, CAPACITY> m_slots;
+    std::atomic<uint32_t> m_nextSlot;
+    char m_requestIdPrefix[REQUEST_ID_PREFIX_LENGTH];
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
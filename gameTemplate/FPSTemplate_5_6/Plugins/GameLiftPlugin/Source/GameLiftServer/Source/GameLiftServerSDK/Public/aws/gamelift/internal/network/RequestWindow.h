@@ -0,0 +1,91 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Bounds the number of requests in flight at once on the Amazon GameLift Servers websocket.
+ * Requests are multiplexed over the single connection by request ID, so any number of callers can
+ * have a round trip outstanding; the window caps that number and queues senders for a free slot
+ * instead of piling requests onto the socket when it is full.
+ *
+ * Waiting does not hold a thread: a queued sender is handed its slot, in arrival order, by the
+ * Release() that frees it.
+ *
+ * The window also keeps per-action latency counters, split into time spent waiting for a slot and
+ * time spent on the wire, so queueing under load is visible.
+ */
+class RequestWindow {
+public:
+    static constexpr const int DEFAULT_MAX_IN_FLIGHT_REQUESTS = 16;
+    static constexpr const int ACQUIRE_TIMEOUT_MILLIS = 20000; // 20 seconds
+
+    struct ActionLatency {
+        uint64_t requestCount = 0;
+        uint64_t failureCount = 0;
+        uint64_t totalQueuedMicros = 0;
+        uint64_t maxQueuedMicros = 0;
+        uint64_t totalRoundTripMicros = 0;
+        uint64_t maxRoundTripMicros = 0;
+    };
+
+    typedef std::function<void(bool acquired)> SlotCallback;
+
+    explicit RequestWindow(int maxInFlightRequests = DEFAULT_MAX_IN_FLIGHT_REQUESTS);
+
+    /**
+     * Takes a free slot and runs onSlot(true) immediately, or queues onSlot until one is released.
+     * A sender still queued after timeout runs onSlot(false) when its turn comes and takes no slot.
+     * Every in-flight request is bounded by its response timeout, so the queue always drains.
+     */
+    void AcquireAsync(std::chrono::milliseconds timeout, SlotCallback onSlot);
+
+    void Release();
+
+    void RecordLatency(const std::string &action, std::chrono::microseconds queued, std::chrono::microseconds roundTrip, bool success);
+
+    std::map<std::string, ActionLatency> GetActionLatencies() const;
+
+    int GetMaxInFlightRequests() const { return m_maxInFlightRequests; }
+
+    int GetInFlightRequests() const;
+
+private:
+    struct Waiter {
+        std::chrono::steady_clock::time_point deadline;
+        SlotCallback onSlot;
+    };
+
+    const int m_maxInFlightRequests;
+    int m_inFlightRequests;
+
+    mutable std::mutex m_windowMutex;
+    std::deque<Waiter> m_waiters;
+
+    mutable std::mutex m_latencyMutex;
+    std::map<std::string, ActionLatency> m_actionLatencies;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -11,9 +11,16 @@
  */
 #pragma once
 
+#include <aws/gamelift/internal/network/GameLiftEventHandlerTable.h>
+#include <aws/gamelift/internal/network/GameLiftExecutor.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/network/PendingRequestTable.h>
 #include <condition_variable>
-#include <thread>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <vector>
 #include <websocketpp/client.hpp>
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic push
@@ -32,52 +39,116 @@ typedef websocketpp::client<websocketpp::config::asio_tls_client> WebSocketppCli
 /**
  * Implementation of a WebSocketClientWrapper for the Websocketpp Library.
  * https://github.com/zaphoyd/websocketpp
+ *
+ * The client runs on the shared GameLiftExecutor I/O thread. Instances must be owned by a
+ * std::shared_ptr so that reconnects scheduled from OnClose can tell whether the wrapper is still
+ * alive. The destructor closes every connection and unregisters the handlers on the I/O thread
+ * before returning, so no handler runs against a destroyed wrapper, and fails every request still
+ * awaiting a response.
  */
-class WebSocketppClientWrapper : public IWebSocketClientWrapper {
+class WebSocketppClientWrapper : public IWebSocketClientWrapper, public std::enable_shared_from_this<WebSocketppClientWrapper> {
 public:
     WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientType> webSocketClient);
 
     Aws::GameLift::GenericOutcome Connect(const Uri &uri) override;
-    Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const std::string &message) override;
+    Aws::GameLift::GenericOutcome SendSocketMessage(Message &message) override;
+    void SendSocketMessageAsync(Message &message, const ResponseCallback &onResponse) override;
     void Disconnect() override;
-    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) override;
+    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(const rapidjson::Value &)> &callback) override;
     bool IsConnected() override;
+    WebSocketConnectMetrics GetConnectMetrics() override;
 
     ~WebSocketppClientWrapper();
 
 private:
     const int WEBSOCKET_OPEN_HANDSHAKE_TIMEOUT_MILLIS = 20000; // 20 seconds
+    const int WEBSOCKET_CLOSE_TIMEOUT_MILLIS = 5000;           // 5 seconds
     const int SERVICE_CALL_TIMEOUT_MILLIS = 20000;             // 20 seconds
     const int OK_STATUS_CODE = 200;
-    const int WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS = 5;
-    const int WAIT_FOR_RECONNECT_MAX_RETRIES = 180 / WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS; // retry up to 3 minutes
+    const int WAIT_FOR_RECONNECT_TIMEOUT_MILLIS = 180000;      // 3 minutes
+    // A connect attempt normally ends with the open or fail handler, at the latest when websocketpp's
+    // own handshake timer fires. This only bounds the wait should neither handler ever run.
+    const int WAIT_FOR_CONNECT_ATTEMPT_TIMEOUT_MILLIS = WEBSOCKET_OPEN_HANDSHAKE_TIMEOUT_MILLIS + 5000;
+    // Longer than a whole Connect() can take: every retry waiting out its attempt, plus the backoff
+    // between them.
+    const int WAIT_FOR_CONNECT_TIMEOUT_MILLIS = 360000;        // 6 minutes
+    const size_t MAX_RETAINED_SERIALIZE_BUFFER_BYTES = 65536;  // 64 KiB
 
     // The WebSocketpp objects this class wraps
     std::shared_ptr<WebSocketppClientType> m_webSocketClient;
+    // The connection Connect() last opened. Swapped by the connection thread and read by senders, so
+    // always accessed under m_connectionLock.
+    std::mutex m_connectionLock;
     WebSocketppClientType::connection_ptr m_connection;
-    std::unique_ptr<std::thread> m_socket_thread_1;
-    std::unique_ptr<std::thread> m_socket_thread_2;
+    // Outgoing frames are built with this manager rather than a connection's, so a message can be
+    // written before we know which connection it will go out on.
+    websocketpp::config::asio_tls_client::con_msg_manager_type::ptr m_messageManager;
+
+    // One TLS context for every connection this client opens. The most recent session ticket is
+    // kept so that reconnects and connection refreshes resume instead of doing a full handshake.
+    websocketpp::lib::shared_ptr<asio::ssl::context> m_tlsContext;
+    std::mutex m_tlsSessionLock;
+    SSL_SESSION *m_tlsSession;
+
+    // One connection's open handshake, completed by the open or fail handler for that connection.
+    struct ConnectAttempt {
+        ConnectAttempt() : done(false), responseCode(websocketpp::http::status_code::uninitialized), startTime(std::chrono::steady_clock::now()) {}
+        bool done;
+        websocketpp::lib::error_code errorCode;
+        websocketpp::http::status_code::value responseCode;
+        std::chrono::steady_clock::time_point startTime;
+    };
 
     // synchronization variables
     std::mutex m_lock;
     std::condition_variable m_cond;
-    bool m_connectionStateChanged;
-    websocketpp::lib::error_code m_fail_error_code;
-    websocketpp::http::status_code::value m_fail_response_code;
+    std::map<websocketpp::connection_hdl, std::shared_ptr<ConnectAttempt>, std::owner_less<websocketpp::connection_hdl>> m_connectAttempts;
+    // Every connection this client opened that may not have closed yet, for the destructor.
+    std::vector<WebSocketppClientType::connection_ptr> m_connections;
+    WebSocketConnectMetrics m_connectMetrics;
 
-    std::map<std::string, std::function<GenericOutcome(std::string)>> m_eventHandlers;
-    std::mutex m_requestToPromiseLock;
-    std::map<std::string, std::promise<GenericOutcome>> m_requestIdToPromise;
+    // Connect() is single-flight: callers that arrive while a connect is running wait for its
+    // outcome. m_connectLock guards these and m_uri, the endpoint the running connect should end up
+    // on; m_uriGeneration changes whenever a caller asks for a new one.
+    std::mutex m_connectLock;
+    bool m_connecting;
+    std::promise<GenericOutcome> m_connectPromise;
+    std::shared_future<GenericOutcome> m_connectOutcome;
+    uint64_t m_uriGeneration;
     Uri m_uri;
 
+    GameLiftEventHandlerTable m_eventHandlers;
+    PendingRequestTable m_pendingRequests;
+
+    // Messages written while the socket is down, sent in order from the open handler of the next
+    // connection. m_outboundLock also guards m_sendConnection, the connection new messages
+    // go out on; it is empty from an abnormal close until the reconnect opens.
+    struct OutboundMessage {
+        std::string requestId;
+        WebSocketppClientType::message_ptr payload;
+    };
+    std::mutex m_outboundLock;
+    std::deque<OutboundMessage> m_outboundQueue;
+    websocketpp::connection_hdl m_sendConnection;
+
     // Helper methods
-    WebSocketppClientType::connection_ptr PerformConnect(const Uri &uri, websocketpp::lib::error_code &error);
-    Aws::GameLift::GenericOutcome SendSocketMessageAsync(const std::string &message);
+    WebSocketppClientType::connection_ptr GetConnection();
+    WebSocketppClientType::connection_ptr ExchangeConnection(WebSocketppClientType::connection_ptr connection);
+    Aws::GameLift::GenericOutcome ConnectWithRetries(const Uri &uri);
+    WebSocketppClientType::connection_ptr PerformConnect(const Uri &uri, websocketpp::lib::error_code &error,
+                                                         websocketpp::http::status_code::value &responseCode);
+    Aws::GameLift::GenericOutcome SendOrQueueMessage(const std::string &requestId, WebSocketppClientType::message_ptr message, bool &queued);
+    Aws::GameLift::GenericOutcome WriteFrame(websocketpp::connection_hdl connection, WebSocketppClientType::message_ptr message);
+    void OnRequestTimeout(uint32_t requestHandle, const std::string &requestId, int timeoutMillis);
+    void RemoveQueuedMessage(const std::string &requestId);
+    void FailQueuedMessages();
 
     // CallBacks
     void OnConnected(websocketpp::connection_hdl connection);
     void OnMessage(websocketpp::connection_hdl connection, websocketpp::config::asio_client::message_type::ptr msgPtr);
     websocketpp::lib::shared_ptr<asio::ssl::context> OnTlsInit(websocketpp::connection_hdl hdl);
+    void OnSocketInit(websocketpp::connection_hdl hdl, asio::ssl::stream<asio::ip::tcp::socket> &socket);
+    static int OnNewTlsSession(SSL *ssl, SSL_SESSION *session);
     void OnClose(websocketpp::connection_hdl connection);
     void OnError(websocketpp::connection_hdl connection);
     void OnInterrupt(websocketpp::connection_hdl connection);
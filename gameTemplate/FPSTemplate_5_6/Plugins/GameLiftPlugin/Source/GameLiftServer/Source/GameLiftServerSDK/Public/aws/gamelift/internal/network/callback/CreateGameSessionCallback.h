@@ -37,7 +37,7 @@ public:
      * @param data
      * @return
      */
-    GenericOutcome OnStartGameSession(const std::string &data);
+    GenericOutcome OnStartGameSession(const rapidjson::Value &data);
 
     // Constants
     static constexpr const char *CREATE_GAME_SESSION = "CreateGameSession";
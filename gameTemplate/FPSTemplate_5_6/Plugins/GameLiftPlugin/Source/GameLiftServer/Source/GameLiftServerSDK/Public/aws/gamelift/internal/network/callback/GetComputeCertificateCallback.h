@@ -29,7 +29,7 @@ public:
     ~GetComputeCertificateCallback() = default;
 
     // Methods
-    GenericOutcome OnGetComputeCertificateCallback(const std::string &data);
+    GenericOutcome OnGetComputeCertificateCallback(const rapidjson::Value &data);
 
     static constexpr const char *GET_COMPUTE_CERTIFICATE = "GetComputeCertificate";
 };
@@ -30,7 +30,7 @@ public:
     ~RefreshConnectionCallback() = default;
 
     // Methods
-    GenericOutcome OnRefreshConnection(const std::string &data);
+    GenericOutcome OnRefreshConnection(const rapidjson::Value &data);
 
     static constexpr const char *REFRESH_CONNECTION = "RefreshConnection";
     IGameLiftMessageHandler *m_gameLiftMessageHandler;
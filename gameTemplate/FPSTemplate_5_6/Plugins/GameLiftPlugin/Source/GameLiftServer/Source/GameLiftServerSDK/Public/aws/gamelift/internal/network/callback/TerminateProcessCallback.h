@@ -31,7 +31,7 @@ public:
     ~TerminateProcessCallback() = default;
 
     // Methods
-    GenericOutcome OnTerminateProcess(const std::string &data);
+    GenericOutcome OnTerminateProcess(const rapidjson::Value &data);
 
     static constexpr const char *TERMINATE_PROCESS = "TerminateProcess";
 
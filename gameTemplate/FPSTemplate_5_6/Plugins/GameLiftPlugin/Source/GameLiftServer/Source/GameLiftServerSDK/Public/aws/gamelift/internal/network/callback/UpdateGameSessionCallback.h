@@ -37,7 +37,7 @@ public:
      * @param data
      * @return
      */
-    GenericOutcome OnUpdateGameSession(const std::string &data);
+    GenericOutcome OnUpdateGameSession(const rapidjson::Value &data);
 
     // Constants
     static constexpr const char *UPDATE_GAME_SESSION = "UpdateGameSession";
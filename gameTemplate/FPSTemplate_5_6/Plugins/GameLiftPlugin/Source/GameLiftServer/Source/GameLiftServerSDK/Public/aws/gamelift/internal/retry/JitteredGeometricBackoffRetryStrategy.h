@@ -24,6 +24,12 @@ public:
 
     void apply(const std::function<bool(void)> &callable) override;
 
+    int GetMaxRetries() const { return m_maxRetries; }
+
+    // Jittered delay before retrying after the given (zero-based) failed attempt, for callers that
+    // schedule retries themselves rather than sleeping in apply().
+    int GetRetryDelayMillis(int attempt) const;
+
 private:
     static constexpr const int DEFAULT_MAX_RETRIES = 5;
     static constexpr const int DEFAULT_INITIAL_RETRY_INTERVAL_MS = 1000;
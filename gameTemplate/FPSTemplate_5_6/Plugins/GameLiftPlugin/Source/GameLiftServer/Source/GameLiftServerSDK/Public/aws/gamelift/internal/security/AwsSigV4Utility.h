@@ -13,7 +13,10 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 #include <ctime>
+#include <cstdint>
+#include <openssl/sha.h>
 #include <aws/gamelift/internal/security/SigV4Parameters.h>
 #include <aws/gamelift/common/Outcome.h>
 
@@ -35,6 +38,20 @@ private:
             const std::string &serviceName,
             const std::string &stringToSign);
 
+    /**
+     * @brief Derives the SigV4 signing key (the date -> region -> service -> aws4_request HMAC chain).
+     *
+     * The key only changes when the date, region, service or secret key does, so the last one derived is
+     * cached, keyed by those values with the secret key held only as a SHA-256 hash. Reconnects on the same
+     * day skip the four HMACs.
+     */
+    static void GetSigningKey(
+            const std::string &region,
+            const std::string &secretKey,
+            const std::string &formattedRequestDate,
+            const std::string &serviceName,
+            uint8_t (&signingKey)[SHA256_DIGEST_LENGTH]);
+
     static std::map<std::string, std::string> GenerateSigV4QueryParameters(
             const std::string &credential,
             const std::string &formattedRequestDateTime,
@@ -65,13 +82,29 @@ private:
      * - HMAC: https://datatracker.ietf.org/doc/html/rfc2104
      * - SHA-256: https://datatracker.ietf.org/doc/html/rfc4634
      *
+     * Each thread reuses one HMAC context rather than allocating one per call.
+     *
      * @param key The secret key used for the HMAC operation.
+     * @param keyLength The length of key in bytes.
      * @param data The input data to be authenticated.
-     * @return std::vector<uint8_t> The computed HMAC-SHA256 as a byte vector.
+     * @param dataLength The length of data in bytes.
+     * @param hash Receives the computed HMAC-SHA256.
      */
-    static std::vector <uint8_t> ComputeHmacSha256(const std::vector <uint8_t> &key, const std::string &data);
+    static void ComputeHmacSha256(const uint8_t *key, size_t keyLength, const char *data, size_t dataLength, uint8_t (&hash)[SHA256_DIGEST_LENGTH]);
+
+    static std::string ToHex(const uint8_t *bytes, size_t length);
+
+    struct SigningKeyCacheEntry {
+        bool Valid = false;
+        std::string Date;
+        std::string Region;
+        std::string Service;
+        uint8_t SecretKeyHash[SHA256_DIGEST_LENGTH] = {};
+        uint8_t SigningKey[SHA256_DIGEST_LENGTH] = {};
+    };
 
-    static std::string ToHex(const std::vector <uint8_t> &hashBytes);
+    static std::mutex s_signingKeyMutex;
+    static SigningKeyCacheEntry s_signingKeyCache;
 
     static constexpr const char *DateFormat = "%Y%m%d";
     static constexpr const char *DateTimeFormat = "%Y%m%dT%H%M%SZ";
@@ -19,7 +19,12 @@ namespace Internal {
 
 class GuidGenerator {
 public:
+    static constexpr const int GUID_LENGTH = 36;
+
     static std::string GenerateGuid();
+
+    // Writes a version 4 GUID into buffer, followed by a null terminator.
+    static void GenerateGuid(char (&buffer)[GUID_LENGTH + 1]);
 };
 
 } // namespace Internal
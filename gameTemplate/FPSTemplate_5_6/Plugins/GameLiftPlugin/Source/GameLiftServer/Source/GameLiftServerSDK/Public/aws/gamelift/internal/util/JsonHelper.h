@@ -25,19 +25,69 @@ namespace GameLift {
 namespace Internal {
 
 // Simple Utility Class with some methods to help with json parsing
+//
+// Keys are compile-time constants at every call site, so the per-field helpers are defined inline:
+// the key length is folded into the caller instead of being measured on every read and write, and
+// each read is a single member lookup.
 class JsonHelper {
 public:
-    static std::string SafelyDeserializeString(const rapidjson::Value &value, const char *key);
-    static void WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const std::string &value);
+    /**
+     * Returns the member with the given key, or nullptr if value has no such member.
+     */
+    static inline const rapidjson::Value *FindMember(const rapidjson::Value &value, const char *key) {
+        const rapidjson::Value name(rapidjson::StringRef(key, KeyLength(key)));
+        rapidjson::Value::ConstMemberIterator member = value.FindMember(name);
+        return member == value.MemberEnd() ? nullptr : &member->value;
+    }
 
-    static int SafelyDeserializeInt(const rapidjson::Value &value, const char *key);
-    static void WritePositiveInt(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int value);
+    static inline std::string SafelyDeserializeString(const rapidjson::Value &value, const char *key) {
+        const rapidjson::Value *member = FindMember(value, key);
+        return member && member->IsString() ? std::string(member->GetString(), member->GetStringLength()) : std::string();
+    }
 
-    static int64_t SafelyDeserializeInt64(const rapidjson::Value &value, const char *key);
-    static void WritePositiveInt64(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int64_t value);
+    static inline void WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const std::string &value) {
+        if (!value.empty()) {
+            writer->Key(key, KeyLength(key));
+            writer->String(value.c_str(), static_cast<rapidjson::SizeType>(value.size()));
+        }
+    }
+
+    static inline void WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const char *value) {
+        if (value && value[0] != 0) {
+            writer->Key(key, KeyLength(key));
+            writer->String(value, KeyLength(value));
+        }
+    }
+
+    static inline int SafelyDeserializeInt(const rapidjson::Value &value, const char *key) {
+        const rapidjson::Value *member = FindMember(value, key);
+        return member && member->IsInt() ? member->GetInt() : -1;
+    }
+
+    static inline void WritePositiveInt(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int value) {
+        if (value > 0) {
+            writer->Key(key, KeyLength(key));
+            writer->Int(value);
+        }
+    }
+
+    static inline int64_t SafelyDeserializeInt64(const rapidjson::Value &value, const char *key) {
+        const rapidjson::Value *member = FindMember(value, key);
+        return member && member->IsInt64() ? member->GetInt64() : -1;
+    }
+
+    static inline void WritePositiveInt64(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int64_t value) {
+        if (value > 0) {
+            writer->Key(key, KeyLength(key));
+            writer->Int64(value);
+        }
+    }
 
     static Aws::GameLift::Server::LogParameters SafelyDeserializeLogParameters(const rapidjson::Value &value, const char *key);
     static void WriteLogParameters(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const Aws::GameLift::Server::LogParameters &value);
+
+private:
+    static inline rapidjson::SizeType KeyLength(const char *key) { return static_cast<rapidjson::SizeType>(std::char_traits<char>::length(key)); }
 };
 
 } // namespace Internal
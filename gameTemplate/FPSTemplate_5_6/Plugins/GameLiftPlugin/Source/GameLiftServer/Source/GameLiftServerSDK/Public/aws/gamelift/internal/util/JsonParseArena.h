@@ -0,0 +1,60 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <rapidjson/allocators.h>
+#include <rapidjson/document.h>
+#include <cstddef>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Per-thread memory for parsing incoming json. A JsonParseArena::Document allocates its values and
+ * its parse stack from a buffer the thread keeps, so a typical message is parsed without touching
+ * the heap. Everything the document allocated is released when the outermost Document on the thread
+ * is destroyed, so values must not be kept beyond the Document's lifetime.
+ */
+class JsonParseArena {
+public:
+    typedef rapidjson::MemoryPoolAllocator<> Allocator;
+    typedef rapidjson::GenericDocument<rapidjson::UTF8<>, Allocator, Allocator> DocumentType;
+
+    class Document : public DocumentType {
+    public:
+        Document();
+        ~Document();
+
+        Document(const Document &) = delete;
+        Document &operator=(const Document &) = delete;
+
+    private:
+        JsonParseArena &m_arena;
+    };
+
+private:
+    static constexpr const std::size_t BUFFER_BYTES = 64 * 1024;
+    static constexpr const std::size_t PARSE_STACK_BYTES = 1024;
+
+    JsonParseArena();
+
+    static JsonParseArena &ForCurrentThread();
+
+    char m_buffer[BUFFER_BYTES];
+    Allocator m_allocator;
+    int m_documentCount;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
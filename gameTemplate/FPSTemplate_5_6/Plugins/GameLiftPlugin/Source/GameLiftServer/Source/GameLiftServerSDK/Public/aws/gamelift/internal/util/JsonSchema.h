@@ -0,0 +1,202 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <rapidjson/document.h>
+#include <rapidjson/rapidjson.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Field table for the flat (string, integer and bool) fields of a model, from which that model's
+ * serializer and deserializer are driven.
+ *
+ * Each model defines one constant-initialized table of its fields, binding every json key to a
+ * member. Key lengths are computed at compile time, so writing never measures a key and reading
+ * compares lengths before bytes. Reading walks the object's members once and matches each against
+ * the table, starting from the field after the previous match: messages written by the service or
+ * by this SDK list fields in table order, so a whole object is usually matched in a single scan.
+ *
+ * Fields that are absent or of the wrong type read as the same defaults JsonHelper uses: empty
+ * strings, -1 for integers and false for bools. Empty strings and non-positive integers are not
+ * written. Nested objects, arrays and enums are still handled by the model itself.
+ */
+template <typename T> class JsonSchema {
+public:
+    class Field {
+    public:
+        constexpr Field(const char *key, std::string T::*member) : m_key(key), m_keyLength(KeyLength(key)), m_type(STRING), m_member(member) {}
+        constexpr Field(const char *key, int T::*member) : m_key(key), m_keyLength(KeyLength(key)), m_type(INT), m_member(member) {}
+        constexpr Field(const char *key, long T::*member) : m_key(key), m_keyLength(KeyLength(key)), m_type(LONG), m_member(member) {}
+        constexpr Field(const char *key, long long T::*member) : m_key(key), m_keyLength(KeyLength(key)), m_type(LONG_LONG), m_member(member) {}
+        constexpr Field(const char *key, bool T::*member) : m_key(key), m_keyLength(KeyLength(key)), m_type(BOOL), m_member(member) {}
+
+        inline bool Matches(const rapidjson::Value &name) const {
+            return name.GetStringLength() == m_keyLength && std::memcmp(name.GetString(), m_key, m_keyLength) == 0;
+        }
+
+        inline void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const T &object) const {
+            switch (m_type) {
+            case STRING: {
+                const std::string &value = object.*m_member.String;
+                if (!value.empty()) {
+                    writer->Key(m_key, m_keyLength);
+                    writer->String(value.c_str(), static_cast<rapidjson::SizeType>(value.size()));
+                }
+                break;
+            }
+            case INT:
+                if (object.*m_member.Int > 0) {
+                    writer->Key(m_key, m_keyLength);
+                    writer->Int(object.*m_member.Int);
+                }
+                break;
+            case LONG:
+                if (object.*m_member.Long > 0) {
+                    writer->Key(m_key, m_keyLength);
+                    writer->Int64(static_cast<int64_t>(object.*m_member.Long));
+                }
+                break;
+            case LONG_LONG:
+                if (object.*m_member.LongLong > 0) {
+                    writer->Key(m_key, m_keyLength);
+                    writer->Int64(static_cast<int64_t>(object.*m_member.LongLong));
+                }
+                break;
+            case BOOL:
+                writer->Key(m_key, m_keyLength);
+                writer->Bool(object.*m_member.Bool);
+                break;
+            }
+        }
+
+        inline void Read(const rapidjson::Value &value, T &object) const {
+            switch (m_type) {
+            case STRING:
+                if (value.IsString()) {
+                    (object.*m_member.String).assign(value.GetString(), value.GetStringLength());
+                }
+                break;
+            case INT:
+                if (value.IsInt()) {
+                    object.*m_member.Int = value.GetInt();
+                }
+                break;
+            case LONG:
+                if (value.IsInt64()) {
+                    object.*m_member.Long = static_cast<long>(value.GetInt64());
+                }
+                break;
+            case LONG_LONG:
+                if (value.IsInt64()) {
+                    object.*m_member.LongLong = static_cast<long long>(value.GetInt64());
+                }
+                break;
+            case BOOL:
+                if (value.IsBool()) {
+                    object.*m_member.Bool = value.GetBool();
+                }
+                break;
+            }
+        }
+
+        inline void Reset(T &object) const {
+            switch (m_type) {
+            case STRING:
+                (object.*m_member.String).clear();
+                break;
+            case INT:
+                object.*m_member.Int = -1;
+                break;
+            case LONG:
+                object.*m_member.Long = -1;
+                break;
+            case LONG_LONG:
+                object.*m_member.LongLong = -1;
+                break;
+            case BOOL:
+                object.*m_member.Bool = false;
+                break;
+            }
+        }
+
+    private:
+        enum Type { STRING, INT, LONG, LONG_LONG, BOOL };
+
+        union Member {
+            constexpr Member(std::string T::*member) : String(member) {}
+            constexpr Member(int T::*member) : Int(member) {}
+            constexpr Member(long T::*member) : Long(member) {}
+            constexpr Member(long long T::*member) : LongLong(member) {}
+            constexpr Member(bool T::*member) : Bool(member) {}
+
+            std::string T::*String;
+            int T::*Int;
+            long T::*Long;
+            long long T::*LongLong;
+            bool T::*Bool;
+        };
+
+        static constexpr rapidjson::SizeType KeyLength(const char *key, rapidjson::SizeType length = 0) {
+            return key[length] == 0 ? length : KeyLength(key, length + 1);
+        }
+
+        const char *m_key;
+        rapidjson::SizeType m_keyLength;
+        Type m_type;
+        Member m_member;
+    };
+
+    /**
+     * Writes every field of the table that has a value, in table order.
+     */
+    template <size_t N> static inline void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const T &object, const Field (&fields)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            fields[i].Write(writer, object);
+        }
+    }
+
+    /**
+     * Resets every field of the table to its default, then reads the ones present in value.
+     */
+    template <size_t N> static inline void Read(const rapidjson::Value &value, T &object, const Field (&fields)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            fields[i].Reset(object);
+        }
+        if (!value.IsObject()) {
+            return;
+        }
+
+        size_t next = 0;
+        for (rapidjson::Value::ConstMemberIterator member = value.MemberBegin(); member != value.MemberEnd(); ++member) {
+            for (size_t tried = 0; tried < N; tried++) {
+                const size_t index = (next + tried) % N;
+                if (fields[index].Matches(member->name)) {
+                    fields[index].Read(member->value, object);
+                    next = index + 1;
+                    break;
+                }
+            }
+        }
+    }
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
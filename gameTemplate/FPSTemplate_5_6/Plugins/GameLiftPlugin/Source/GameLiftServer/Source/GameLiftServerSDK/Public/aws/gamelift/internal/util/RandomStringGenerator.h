@@ -11,6 +11,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace Aws {
@@ -20,6 +21,9 @@ namespace Internal {
 class RandomStringGenerator {
 public:
     static std::string GenerateRandomAlphaNumericString(const int stringLength);
+
+    // Fills buffer with exactly length alphanumeric characters. No null terminator is written.
+    static void GenerateRandomAlphaNumericString(char *buffer, std::size_t length);
 };
 
 } // namespace Internal
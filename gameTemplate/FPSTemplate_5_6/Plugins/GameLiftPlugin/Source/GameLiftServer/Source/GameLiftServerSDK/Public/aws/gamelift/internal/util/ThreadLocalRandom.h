@@ -0,0 +1,33 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Per-thread xoshiro256** generator for request IDs, idempotency tokens and GUIDs.
+ *
+ * The process draws from std::random_device once; each thread's state is derived from that seed and a
+ * thread counter, so no thread issues a syscall per ID. Not suitable for anything that must be unguessable.
+ */
+class ThreadLocalRandom {
+public:
+    static uint64_t Next();
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
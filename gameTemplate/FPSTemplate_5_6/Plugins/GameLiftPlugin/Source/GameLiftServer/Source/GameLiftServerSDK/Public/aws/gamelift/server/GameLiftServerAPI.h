@@ -284,6 +284,87 @@ AWS_GAMELIFT_API GetComputeCertificateOutcome GetComputeCertificate();
  */
 AWS_GAMELIFT_API GetFleetRoleCredentialsOutcome GetFleetRoleCredentials(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request);
 
+/*
+ * Asynchronous variants. Each returns immediately; the service call runs on an SDK worker thread.
+ * The optional callback is invoked on that worker thread with the outcome, after which the returned
+ * future becomes ready. Failed preconditions (SDK not initialized, process not ready) complete the
+ * callback and future before the call returns.
+ */
+
+/**
+Asynchronous version of ProcessReady().
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable ProcessReadyAsync(const Aws::GameLift::Server::ProcessParameters &processParameters,
+                                                          const GenericOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of ProcessEnding().
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable ProcessEndingAsync(const GenericOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of ActivateGameSession().
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable ActivateGameSessionAsync(const GenericOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of UpdatePlayerSessionCreationPolicy().
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable UpdatePlayerSessionCreationPolicyAsync(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                                               const GenericOutcomeCallback &callback = nullptr);
+
+#ifdef GAMELIFT_USE_STD
+/**
+Asynchronous version of AcceptPlayerSession().
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable AcceptPlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of RemovePlayerSession().
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable RemovePlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback = nullptr);
+#else
+/**
+Asynchronous version of AcceptPlayerSession(). The player session ID is copied before returning.
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable AcceptPlayerSessionAsync(const char *playerSessionId, const GenericOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of RemovePlayerSession(). The player session ID is copied before returning.
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable RemovePlayerSessionAsync(const char *playerSessionId, const GenericOutcomeCallback &callback = nullptr);
+#endif
+
+/**
+Asynchronous version of DescribePlayerSessions().
+*/
+AWS_GAMELIFT_API DescribePlayerSessionsOutcomeCallable
+DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                            const DescribePlayerSessionsOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of StartMatchBackfill().
+*/
+AWS_GAMELIFT_API StartMatchBackfillOutcomeCallable StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &request,
+                                                                           const StartMatchBackfillOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of StopMatchBackfill().
+*/
+AWS_GAMELIFT_API GenericOutcomeCallable StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &request,
+                                                               const GenericOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of GetComputeCertificate().
+*/
+AWS_GAMELIFT_API GetComputeCertificateOutcomeCallable GetComputeCertificateAsync(const GetComputeCertificateOutcomeCallback &callback = nullptr);
+
+/**
+Asynchronous version of GetFleetRoleCredentials().
+*/
+AWS_GAMELIFT_API GetFleetRoleCredentialsOutcomeCallable GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                                                                     const GetFleetRoleCredentialsOutcomeCallback &callback = nullptr);
+
 } // namespace Server
 } // namespace GameLift
 } // namespace Aws
@@ -17,6 +17,7 @@
 #endif
 
 #include <aws/gamelift/common/GameLift_EXPORTS.h>
+#include <cstring>
 
 #ifndef MAX_STRING_LIST_LENGTH
 #define MAX_STRING_LIST_LENGTH 10
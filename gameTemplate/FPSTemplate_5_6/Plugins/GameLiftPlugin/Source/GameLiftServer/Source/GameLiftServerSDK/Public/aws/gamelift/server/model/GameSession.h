@@ -21,6 +21,13 @@
 #include <aws/gamelift/server/model/GameSessionStatus.h>
 #include <aws/gamelift/server/model/PlayerSessionCreationPolicy.h>
 
+#ifndef GAMELIFT_USE_STD
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#endif
+
 #ifndef GAMELIFT_USE_STD
 #ifndef MAX_GAME_PROPERTIES
 #define MAX_GAME_PROPERTIES 32
@@ -590,62 +597,60 @@ private:
     std::string m_dnsName;
 #else
 public:
-    GameSession() : m_maximumPlayerSessionCount(0), m_status(), m_gameProperties_count(0), m_port(0) {
-        memset(m_gameSessionId, 0, MAX_SESSION_ID_LENGTH);
-        memset(m_name, 0, MAX_SESSION_NAME_LENGTH);
-        memset(m_fleetId, 0, MAX_FLEET_ID_LENGTH);
-        memset(m_gameProperties, 0, MAX_GAME_PROPERTIES);
-        memset(m_ipAddress, 0, MAX_IP_LENGTH);
-        memset(m_gameSessionData, 0, MAX_GAME_SESSION_DATA_LENGTH);
-        memset(m_matchmakerData, 0, MAX_MATCHMAKER_DATA_LENGTH);
-        memset(m_dnsName, 0, MAX_DNS_NAME_LENGTH);
+    GameSession() : m_maximumPlayerSessionCount(0), m_status(), m_gameProperties(nullptr), m_gameProperties_count(0), m_gameProperties_capacity(0), m_port(0),
+                    m_strings(nullptr) {
+        memset(m_stringOffsets, 0, sizeof(m_stringOffsets));
+        memset(m_stringLengths, 0, sizeof(m_stringLengths));
     }
 
     /**
      * <p>Destructor.</p>
      */
-    ~GameSession() {}
+    ~GameSession() {
+        delete[] m_gameProperties;
+        delete[] m_strings;
+    }
 
     /**
      * <p>Copy Constructor.</p>
      */
-    GameSession(const GameSession &other)
-        : m_maximumPlayerSessionCount(other.m_maximumPlayerSessionCount), m_status(other.m_status), m_gameProperties_count(other.m_gameProperties_count),
-          m_port(other.m_port) {
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_name, other.m_name, sizeof(other.m_name));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_gameSessionData, other.m_gameSessionData, sizeof(other.m_gameSessionData));
-        strncpy(m_matchmakerData, other.m_matchmakerData, sizeof(other.m_matchmakerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
-
-        std::copy(std::begin(other.m_gameProperties), std::end(other.m_gameProperties), std::begin(m_gameProperties));
-    }
+    GameSession(const GameSession &other) : GameSession() { *this = other; }
 
     /**
      * <p>Move Constructor.</p>
      */
-    GameSession(GameSession &&other) { *this = std::move(other); }
+    GameSession(GameSession &&other) : GameSession() { *this = std::move(other); }
 
     /**
      * <p>Copy assignment Constructor.</p>
      */
     GameSession &operator=(const GameSession &other) {
+        if (this == &other) {
+            return *this;
+        }
         m_maximumPlayerSessionCount = other.m_maximumPlayerSessionCount;
-        m_gameProperties_count = other.m_gameProperties_count;
         m_port = other.m_port;
         m_status = other.m_status;
 
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_name, other.m_name, sizeof(other.m_name));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_gameSessionData, other.m_gameSessionData, sizeof(other.m_gameSessionData));
-        strncpy(m_matchmakerData, other.m_matchmakerData, sizeof(other.m_matchmakerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
-
-        std::copy(std::begin(other.m_gameProperties), std::end(other.m_gameProperties), std::begin(m_gameProperties));
+        // Only the bytes in use are copied: the strings buffer is exactly as long as its contents,
+        // and only the properties that were added.
+        char *strings = nullptr;
+        if (other.m_strings) {
+            const size_t stringsSize = other.m_stringOffsets[STRING_FIELD_COUNT - 1] + other.m_stringLengths[STRING_FIELD_COUNT - 1] + 1;
+            strings = new char[stringsSize];
+            memcpy(strings, other.m_strings, stringsSize);
+        }
+        delete[] m_strings;
+        m_strings = strings;
+        memcpy(m_stringOffsets, other.m_stringOffsets, sizeof(m_stringOffsets));
+        memcpy(m_stringLengths, other.m_stringLengths, sizeof(m_stringLengths));
+
+        GameProperty *gameProperties = other.m_gameProperties_count > 0 ? new GameProperty[other.m_gameProperties_count] : nullptr;
+        std::copy(other.m_gameProperties, other.m_gameProperties + other.m_gameProperties_count, gameProperties);
+        delete[] m_gameProperties;
+        m_gameProperties = gameProperties;
+        m_gameProperties_count = other.m_gameProperties_count;
+        m_gameProperties_capacity = other.m_gameProperties_count;
 
         return *this;
     }
@@ -654,49 +659,41 @@ public:
      * <p>Move assignment Constructor.</p>
      */
     GameSession &operator=(GameSession &&other) {
+        if (this == &other) {
+            return *this;
+        }
         m_maximumPlayerSessionCount = other.m_maximumPlayerSessionCount;
-        m_gameProperties_count = other.m_gameProperties_count;
         m_port = other.m_port;
         m_status = other.m_status;
 
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_name, other.m_name, sizeof(other.m_name));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_gameSessionData, other.m_gameSessionData, sizeof(other.m_gameSessionData));
-        strncpy(m_matchmakerData, other.m_matchmakerData, sizeof(other.m_matchmakerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
-
-        std::copy(std::begin(other.m_gameProperties), std::end(other.m_gameProperties), std::begin(m_gameProperties));
+        std::swap(m_strings, other.m_strings);
+        memcpy(m_stringOffsets, other.m_stringOffsets, sizeof(m_stringOffsets));
+        memcpy(m_stringLengths, other.m_stringLengths, sizeof(m_stringLengths));
+        std::swap(m_gameProperties, other.m_gameProperties);
+        std::swap(m_gameProperties_capacity, other.m_gameProperties_capacity);
+        m_gameProperties_count = other.m_gameProperties_count;
 
-        other.m_maximumPlayerSessionCount = 0;
+        // Leave the moved-from session empty.
+        delete[] other.m_strings;
+        other.m_strings = nullptr;
+        memset(other.m_stringOffsets, 0, sizeof(other.m_stringOffsets));
+        memset(other.m_stringLengths, 0, sizeof(other.m_stringLengths));
         other.m_gameProperties_count = 0;
+        other.m_maximumPlayerSessionCount = 0;
         other.m_port = 0;
 
-        memset(other.m_gameSessionId, 0, MAX_SESSION_ID_LENGTH);
-        memset(other.m_ipAddress, 0, MAX_IP_LENGTH);
-        memset(other.m_name, 0, MAX_SESSION_NAME_LENGTH);
-        memset(other.m_fleetId, 0, MAX_FLEET_ID_LENGTH);
-        memset(other.m_gameProperties, 0, MAX_GAME_PROPERTIES);
-        memset(other.m_gameSessionData, 0, MAX_GAME_SESSION_DATA_LENGTH);
-        memset(other.m_matchmakerData, 0, MAX_MATCHMAKER_DATA_LENGTH);
-        memset(other.m_dnsName, 0, MAX_DNS_NAME_LENGTH);
-
         return *this;
     }
 
     /**
      * <p>Unique identifier for a game session.</p>
      */
-    inline const char *GetGameSessionId() const { return m_gameSessionId; }
+    inline const char *GetGameSessionId() const { return GetString(GAME_SESSION_ID); }
 
     /**
      * <p>Unique identifier for a game session.</p>
      */
-    inline void SetGameSessionId(const char *value) {
-        strncpy(m_gameSessionId, value, sizeof(m_gameSessionId));
-        m_gameSessionId[sizeof(m_gameSessionId) - 1] = 0;
-    }
+    inline void SetGameSessionId(const char *value) { SetString(GAME_SESSION_ID, value); }
 
     /**
      * <p>Unique identifier for a game session.</p>
@@ -710,16 +707,13 @@ public:
      * <p>Descriptive label associated with a game session. Session names do not need
      * to be unique.</p>
      */
-    inline const char *GetName() const { return m_name; }
+    inline const char *GetName() const { return GetString(NAME); }
 
     /**
      * <p>Descriptive label associated with a game session. Session names do not need
      * to be unique.</p>
      */
-    inline void SetName(const char *value) {
-        strncpy(m_name, value, sizeof(m_name));
-        m_name[sizeof(m_name) - 1] = 0;
-    }
+    inline void SetName(const char *value) { SetString(NAME, value); }
 
     /**
      * <p>Descriptive label associated with a game session. Session names do not need
@@ -733,15 +727,12 @@ public:
     /**
      * <p>Unique identifier for a fleet.</p>
      */
-    inline const char *GetFleetId() const { return m_fleetId; }
+    inline const char *GetFleetId() const { return GetString(FLEET_ID); }
 
     /**
      * <p>Unique identifier for a fleet.</p>
      */
-    inline void SetFleetId(const char *value) {
-        strncpy(m_fleetId, value, sizeof(m_fleetId));
-        m_fleetId[sizeof(m_fleetId) - 1] = 0;
-    }
+    inline void SetFleetId(const char *value) { SetString(FLEET_ID, value); }
 
     /**
      * <p>Unique identifier for a fleet.</p>
@@ -817,9 +808,18 @@ public:
      * <p>Set of custom property for the game session.</p>
      */
     inline void AddGameProperty(GameProperty gameProperty) {
-        if (m_gameProperties_count < MAX_GAME_PROPERTIES) {
-            m_gameProperties[m_gameProperties_count++] = gameProperty;
+        if (m_gameProperties_count >= MAX_GAME_PROPERTIES) {
+            return;
         }
+        if (m_gameProperties_count == m_gameProperties_capacity) {
+            const int capacity = m_gameProperties_capacity == 0 ? 4 : std::min(m_gameProperties_capacity * 2, MAX_GAME_PROPERTIES);
+            GameProperty *gameProperties = new GameProperty[capacity];
+            std::copy(m_gameProperties, m_gameProperties + m_gameProperties_count, gameProperties);
+            delete[] m_gameProperties;
+            m_gameProperties = gameProperties;
+            m_gameProperties_capacity = capacity;
+        }
+        m_gameProperties[m_gameProperties_count++] = std::move(gameProperty);
     };
 
     /**
@@ -834,16 +834,13 @@ public:
      * <p>IP address of the game session. To connect to a game server process, an
      * app needs both the IP address and port number.</p>
      */
-    inline const char *GetIpAddress() const { return m_ipAddress; }
+    inline const char *GetIpAddress() const { return GetString(IP_ADDRESS); }
 
     /**
      * <p>IP address of the game session. To connect to a game server process, an
      * app needs both the IP address and port number.</p>
      */
-    inline void SetIpAddress(const char *value) {
-        strncpy(m_ipAddress, value, sizeof(m_ipAddress));
-        m_ipAddress[sizeof(m_ipAddress) - 1] = 0;
-    }
+    inline void SetIpAddress(const char *value) { SetString(IP_ADDRESS, value); }
 
     /**
      * <p>IP address of the game session. To connect to a game server process, an
@@ -878,15 +875,12 @@ public:
     /**
      * <p>Custom data for the game session.</p>
      */
-    inline const char *GetGameSessionData() const { return m_gameSessionData; }
+    inline const char *GetGameSessionData() const { return GetString(GAME_SESSION_DATA); }
 
     /**
      * <p>Custom data for the game session.</p>
      */
-    inline void SetGameSessionData(const char *value) {
-        strncpy(m_gameSessionData, value, sizeof(m_gameSessionData));
-        m_gameSessionData[sizeof(m_gameSessionData) - 1] = 0;
-    }
+    inline void SetGameSessionData(const char *value) { SetString(GAME_SESSION_DATA, value); }
 
     /**
      * <p>Custom data for the game session.</p>
@@ -899,15 +893,12 @@ public:
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
      */
-    inline const char *GetMatchmakerData() const { return m_matchmakerData; }
+    inline const char *GetMatchmakerData() const { return GetString(MATCHMAKER_DATA); }
 
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
      */
-    inline void SetMatchmakerData(const char *value) {
-        strncpy(m_matchmakerData, value, sizeof(m_matchmakerData));
-        m_matchmakerData[sizeof(m_matchmakerData) - 1] = 0;
-    }
+    inline void SetMatchmakerData(const char *value) { SetString(MATCHMAKER_DATA, value); }
 
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
@@ -921,16 +912,13 @@ public:
      * The DNS name of the host running a game server process, used for establishing a TLS
      * connection for a game session.
      */
-    inline const char *GetDnsName() const { return m_dnsName; }
+    inline const char *GetDnsName() const { return GetString(DNS_NAME); }
 
     /**
      * The DNS name of the host running a game server process, used for establishing a TLS
      * connection for a game session.
      */
-    inline void SetDnsName(const char *value) {
-        strncpy(m_dnsName, value, sizeof(m_dnsName));
-        m_dnsName[sizeof(m_dnsName) - 1] = 0;
-    }
+    inline void SetDnsName(const char *value) { SetString(DNS_NAME, value); }
 
     /**
      * The DNS name of the host running a game server process, used for establishing a TLS
@@ -942,18 +930,72 @@ public:
     }
 
 private:
-    char m_gameSessionId[MAX_SESSION_ID_LENGTH];
-    char m_name[MAX_SESSION_NAME_LENGTH];
-    char m_fleetId[MAX_FLEET_ID_LENGTH];
+    // The string fields live back to back, each NUL terminated, in one heap buffer sized to fit, so
+    // the object itself stays small and a move is a pointer swap. Each field keeps the length limit
+    // of the fixed array it replaces.
+    enum StringField { GAME_SESSION_ID, NAME, FLEET_ID, IP_ADDRESS, GAME_SESSION_DATA, MATCHMAKER_DATA, DNS_NAME, STRING_FIELD_COUNT };
+
+    static inline size_t MaxStringLength(StringField field) {
+        switch (field) {
+        case GAME_SESSION_ID:
+            return MAX_SESSION_ID_LENGTH - 1;
+        case NAME:
+            return MAX_SESSION_NAME_LENGTH - 1;
+        case FLEET_ID:
+            return MAX_FLEET_ID_LENGTH - 1;
+        case IP_ADDRESS:
+            return MAX_IP_LENGTH - 1;
+        case GAME_SESSION_DATA:
+            return MAX_GAME_SESSION_DATA_LENGTH - 1;
+        case MATCHMAKER_DATA:
+            return MAX_MATCHMAKER_DATA_LENGTH - 1;
+        case DNS_NAME:
+            return MAX_DNS_NAME_LENGTH - 1;
+        default:
+            return 0;
+        }
+    }
+
+    inline const char *GetString(StringField field) const { return m_strings ? m_strings + m_stringOffsets[field] : ""; }
+
+    inline void SetString(StringField field, const char *value) {
+        size_t length = 0;
+        const size_t maxLength = MaxStringLength(field);
+        while (value && length < maxLength && value[length] != 0) {
+            length++;
+        }
+
+        size_t stringsSize = 0;
+        for (int i = 0; i < STRING_FIELD_COUNT; i++) {
+            stringsSize += (i == field ? length : m_stringLengths[i]) + 1;
+        }
+
+        // value may point into the current buffer, so build the new one before releasing it.
+        char *strings = new char[stringsSize];
+        size_t offset = 0;
+        for (int i = 0; i < STRING_FIELD_COUNT; i++) {
+            const size_t fieldLength = i == field ? length : m_stringLengths[i];
+            if (fieldLength > 0) {
+                memcpy(strings + offset, i == field ? value : m_strings + m_stringOffsets[i], fieldLength);
+            }
+            strings[offset + fieldLength] = 0;
+            m_stringOffsets[i] = static_cast<uint32_t>(offset);
+            m_stringLengths[i] = static_cast<uint32_t>(fieldLength);
+            offset += fieldLength + 1;
+        }
+        delete[] m_strings;
+        m_strings = strings;
+    }
+
     int m_maximumPlayerSessionCount;
     GameSessionStatus m_status;
-    GameProperty m_gameProperties[MAX_GAME_PROPERTIES];
+    GameProperty *m_gameProperties;
     int m_gameProperties_count;
-    char m_ipAddress[MAX_IP_LENGTH];
+    int m_gameProperties_capacity;
     int m_port;
-    char m_gameSessionData[MAX_GAME_SESSION_DATA_LENGTH];
-    char m_matchmakerData[MAX_MATCHMAKER_DATA_LENGTH];
-    char m_dnsName[MAX_DNS_NAME_LENGTH];
+    char *m_strings;
+    uint32_t m_stringOffsets[STRING_FIELD_COUNT];
+    uint32_t m_stringLengths[STRING_FIELD_COUNT];
 #endif
 };
 
@@ -353,7 +353,7 @@ public:
 
         inline const char *GetName() const { return m_name; }
 
-        inline AttributeValue GetValue() const { return m_value; }
+        inline const AttributeValue &GetValue() const { return m_value; }
 
     private:
         AttributeStringType m_name;
@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/GameLiftCommandQueue.h"
+
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(GameLiftCommandQueueLog, Log, All);
+
+FGameLiftCommandQueue::FGameLiftCommandQueue(int32 InCapacity) :
+    Capacity(InCapacity),
+    Depth(0),
+    Rejected(0)
+{
+}
+
+bool FGameLiftCommandQueue::Enqueue(const TCHAR* Name, EGameLiftCommandKind Kind, TUniqueFunction<void()> Work)
+{
+    const int32 PreviousDepth = Depth.fetch_add(1, std::memory_order_relaxed);
+    if (PreviousDepth >= Capacity)
+    {
+        if (Kind == EGameLiftCommandKind::Droppable)
+        {
+            Depth.fetch_sub(1, std::memory_order_relaxed);
+            Rejected.fetch_add(1, std::memory_order_relaxed);
+            UE_LOG(GameLiftCommandQueueLog, Error, TEXT("Game thread command queue full (%d), dropping %s"), Capacity, Name);
+            return false;
+        }
+        UE_LOG(GameLiftCommandQueueLog, Warning, TEXT("Game thread command queue over capacity (%d/%d), still queuing %s"),
+            PreviousDepth + 1, Capacity, Name);
+    }
+
+    Commands.Enqueue(FCommand{ Name, MoveTemp(Work), FPlatformTime::Seconds() });
+    return true;
+}
+
+int32 FGameLiftCommandQueue::Drain(double BudgetSeconds)
+{
+    const int32 QueuedCommands = Depth.load(std::memory_order_relaxed);
+    if (QueuedCommands == 0)
+    {
+        return 0;
+    }
+    WindowStats.MaxDepth = FMath::Max(WindowStats.MaxDepth, QueuedCommands);
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    int32 ExecutedCommands = 0;
+    FCommand Command;
+    while (Commands.Dequeue(Command))
+    {
+        Depth.fetch_sub(1, std::memory_order_relaxed);
+
+        const double LatencySeconds = FPlatformTime::Seconds() - Command.EnqueuedAtSeconds;
+        WindowStats.MaxLatencySeconds = FMath::Max(WindowStats.MaxLatencySeconds, LatencySeconds);
+        WindowStats.TotalLatencySeconds += LatencySeconds;
+
+        Command.Work();
+        Command.Work.Reset();
+        ExecutedCommands++;
+
+        if (FPlatformTime::Seconds() - StartSeconds >= BudgetSeconds)
+        {
+            break;
+        }
+    }
+
+    WindowStats.Executed += ExecutedCommands;
+    return ExecutedCommands;
+}
+
+FGameLiftCommandQueue::FStats FGameLiftCommandQueue::ConsumeStats()
+{
+    FStats Stats = WindowStats;
+    Stats.Rejected = Rejected.exchange(0, std::memory_order_relaxed);
+    WindowStats = FStats();
+    return Stats;
+}
@@ -0,0 +1,231 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/GameLiftFrameTimeHistogram.h"
+
+namespace
+{
+    uint32 ToMicroseconds(double Seconds)
+    {
+        return (uint32)FMath::Clamp(Seconds * 1000000.0, 0.0, (double)MAX_uint32);
+    }
+
+    float ToMilliseconds(double Microseconds)
+    {
+        return (float)(Microseconds / 1000.0);
+    }
+}
+
+FGameLiftLatencyHistogram::FGameLiftLatencyHistogram()
+{
+    Reset();
+}
+
+void FGameLiftLatencyHistogram::Record(uint32 Microseconds)
+{
+    ++Counts[GetBucketIndex(Microseconds)];
+    ++TotalCount;
+}
+
+void FGameLiftLatencyHistogram::Remove(uint32 Microseconds)
+{
+    uint32& Count = Counts[GetBucketIndex(Microseconds)];
+    check(Count > 0 && TotalCount > 0);
+    --Count;
+    --TotalCount;
+}
+
+void FGameLiftLatencyHistogram::Merge(const FGameLiftLatencyHistogram& Other)
+{
+    for (int32 Index = 0; Index < NumBuckets; ++Index)
+    {
+        Counts[Index] += Other.Counts[Index];
+    }
+    TotalCount += Other.TotalCount;
+}
+
+void FGameLiftLatencyHistogram::Reset()
+{
+    FMemory::Memzero(Counts);
+    TotalCount = 0;
+}
+
+uint32 FGameLiftLatencyHistogram::GetPercentile(double Fraction) const
+{
+    if (TotalCount == 0)
+    {
+        return 0;
+    }
+
+    const uint64 Target = FMath::Max<uint64>(1, (uint64)FMath::CeilToDouble(FMath::Clamp(Fraction, 0.0, 1.0) * TotalCount));
+    uint64 Seen = 0;
+    for (int32 Index = 0; Index < NumBuckets; ++Index)
+    {
+        Seen += Counts[Index];
+        if (Seen >= Target)
+        {
+            return GetBucketUpperBound(Index);
+        }
+    }
+    return GetBucketUpperBound(NumBuckets - 1);
+}
+
+FString FGameLiftLatencyHistogram::ToCsv() const
+{
+    FString Csv = TEXT("upper_bound_us,count\n");
+    ForEachBucket([&Csv](uint32 UpperBound, uint32 Count)
+    {
+        Csv += FString::Printf(TEXT("%u,%u\n"), UpperBound, Count);
+    });
+    return Csv;
+}
+
+int32 FGameLiftLatencyHistogram::GetBucketIndex(uint32 Microseconds)
+{
+    if (Microseconds < (uint32)SubBucketCount)
+    {
+        return (int32)Microseconds;
+    }
+
+    Microseconds = FMath::Min(Microseconds, (1u << MaxExponent) - 1);
+    const int32 Exponent = (int32)FMath::FloorLog2(Microseconds);
+    const int32 SubBucket = (int32)(Microseconds >> (Exponent - SubBucketBits)) & (SubBucketCount - 1);
+    return SubBucketCount + (Exponent - SubBucketBits) * SubBucketCount + SubBucket;
+}
+
+uint32 FGameLiftLatencyHistogram::GetBucketUpperBound(int32 Index)
+{
+    if (Index < SubBucketCount)
+    {
+        return (uint32)Index;
+    }
+
+    const int32 Exponent = (Index - SubBucketCount) / SubBucketCount + SubBucketBits;
+    const uint32 SubBucket = (uint32)((Index - SubBucketCount) % SubBucketCount);
+    const uint32 Width = 1u << (Exponent - SubBucketBits);
+    return ((SubBucketCount + SubBucket) * Width) + Width - 1;
+}
+
+FGameLiftFrameTimeTracker::FGameLiftFrameTimeTracker() :
+    RingHead(0),
+    RingCount(0),
+    RingSumMicroseconds(0),
+    MatchSumMicroseconds(0),
+    MatchMaxMicroseconds(0),
+    NumHitchThresholds(0)
+{
+    FMemory::Memzero(RingMicroseconds);
+    FMemory::Memzero(HitchThresholdsMicroseconds);
+}
+
+void FGameLiftFrameTimeTracker::SetHitchThresholds(const TArray<float>& ThresholdsMs)
+{
+    NumHitchThresholds = FMath::Min(ThresholdsMs.Num(), FGameLiftFrameTimeSummary::MaxHitchThresholds);
+    for (int32 Index = 0; Index < NumHitchThresholds; ++Index)
+    {
+        HitchThresholdsMicroseconds[Index] = ToMicroseconds(ThresholdsMs[Index] / 1000.0);
+    }
+}
+
+void FGameLiftFrameTimeTracker::RecordFrame(double FrameSeconds, double IdleSeconds, double SdkCommandSeconds)
+{
+    const uint32 FrameMicroseconds = ToMicroseconds(FrameSeconds);
+
+    // Slide the window: the oldest frame leaves the histogram as the newest one enters
+    if (RingCount == WindowFrames)
+    {
+        const uint32 Oldest = RingMicroseconds[RingHead];
+        WindowHistogram.Remove(Oldest);
+        RingSumMicroseconds -= Oldest;
+    }
+    else
+    {
+        ++RingCount;
+    }
+    RingMicroseconds[RingHead] = FrameMicroseconds;
+    RingHead = (RingHead + 1) % WindowFrames;
+    RingSumMicroseconds += FrameMicroseconds;
+    WindowHistogram.Record(FrameMicroseconds);
+
+    MatchHistogram.Record(FrameMicroseconds);
+    MatchSumMicroseconds += FrameMicroseconds;
+    MatchMaxMicroseconds = FMath::Max(MatchMaxMicroseconds, FrameMicroseconds);
+
+    const double WorkSeconds = FMath::Max(FrameSeconds - IdleSeconds, 0.0);
+    for (FPhaseTotals* Totals : { &WindowPhases, &MatchPhases })
+    {
+        Totals->WorkSeconds += WorkSeconds;
+        Totals->IdleSeconds += IdleSeconds;
+        Totals->SdkCommandSeconds += SdkCommandSeconds;
+        ++Totals->Frames;
+        for (int32 Index = 0; Index < NumHitchThresholds; ++Index)
+        {
+            if (FrameMicroseconds >= HitchThresholdsMicroseconds[Index])
+            {
+                ++Totals->HitchCounts[Index];
+            }
+        }
+    }
+}
+
+FGameLiftFrameTimeSummary FGameLiftFrameTimeTracker::ConsumeWindow()
+{
+    FGameLiftFrameTimeSummary Summary;
+    FillPercentiles(WindowHistogram, Summary);
+    if (RingCount > 0)
+    {
+        Summary.MeanMs = ToMilliseconds((double)RingSumMicroseconds / RingCount);
+
+        // Exact rather than bucketed; scanning the ring once per update is cheap
+        uint32 MaxMicroseconds = 0;
+        for (int32 Index = 0; Index < RingCount; ++Index)
+        {
+            MaxMicroseconds = FMath::Max(MaxMicroseconds, RingMicroseconds[Index]);
+        }
+        Summary.MaxMs = ToMilliseconds(MaxMicroseconds);
+    }
+
+    FillPhases(WindowPhases, Summary);
+    WindowPhases = FPhaseTotals();
+    return Summary;
+}
+
+FGameLiftFrameTimeSummary FGameLiftFrameTimeTracker::SummarizeMatch() const
+{
+    FGameLiftFrameTimeSummary Summary;
+    FillPercentiles(MatchHistogram, Summary);
+    if (MatchHistogram.GetCount() > 0)
+    {
+        Summary.MeanMs = ToMilliseconds((double)MatchSumMicroseconds / MatchHistogram.GetCount());
+        Summary.MaxMs = ToMilliseconds(MatchMaxMicroseconds);
+    }
+    FillPhases(MatchPhases, Summary);
+    return Summary;
+}
+
+void FGameLiftFrameTimeTracker::ResetMatch()
+{
+    MatchHistogram.Reset();
+    MatchSumMicroseconds = 0;
+    MatchMaxMicroseconds = 0;
+    MatchPhases = FPhaseTotals();
+}
+
+void FGameLiftFrameTimeTracker::FillPhases(const FPhaseTotals& Totals, FGameLiftFrameTimeSummary& OutSummary)
+{
+    if (Totals.Frames > 0)
+    {
+        OutSummary.WorkMs = (float)(Totals.WorkSeconds * 1000.0 / Totals.Frames);
+        OutSummary.IdleMs = (float)(Totals.IdleSeconds * 1000.0 / Totals.Frames);
+        OutSummary.SdkCommandsMs = (float)(Totals.SdkCommandSeconds * 1000.0 / Totals.Frames);
+    }
+    FMemory::Memcpy(OutSummary.HitchCounts, Totals.HitchCounts, sizeof(OutSummary.HitchCounts));
+}
+
+void FGameLiftFrameTimeTracker::FillPercentiles(const FGameLiftLatencyHistogram& Histogram, FGameLiftFrameTimeSummary& OutSummary)
+{
+    OutSummary.FrameCount = (int32)FMath::Min<uint64>(Histogram.GetCount(), MAX_int32);
+    OutSummary.P50Ms = ToMilliseconds(Histogram.GetPercentile(0.50));
+    OutSummary.P95Ms = ToMilliseconds(Histogram.GetPercentile(0.95));
+    OutSummary.P99Ms = ToMilliseconds(Histogram.GetPercentile(0.99));
+}
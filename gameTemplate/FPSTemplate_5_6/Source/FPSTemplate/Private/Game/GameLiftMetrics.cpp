@@ -0,0 +1,344 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/GameLiftMetrics.h"
+
+#include "Game/GameLiftFrameTimeHistogram.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(GameLiftMetricsLog, Log, All);
+
+namespace
+{
+    std::atomic<uint64> NextRegistryId{ 1 };
+
+    // Histogram values are stored in thousandths
+    constexpr double HistogramScale = 1000.0;
+
+    struct FCachedShard
+    {
+        uint64 RegistryId = 0;
+        void* Shard = nullptr;
+    };
+    thread_local FCachedShard CachedShard;
+}
+
+struct FGameLiftMetricsRegistry::FShard
+{
+    struct FHistogramValues
+    {
+        FGameLiftLatencyHistogram Histogram;
+        double Sum = 0.0;
+        double Min = 0.0;
+        double Max = 0.0;
+    };
+
+    explicit FShard(uint32 InOwnerThreadId) :
+        OwnerThreadId(InOwnerThreadId)
+    {
+        FMemory::Memzero(Touched);
+        FMemory::Memzero(Counters);
+        FMemory::Memzero(Gauges);
+        FMemory::Memzero(GaugeSequences);
+    }
+
+    const uint32 OwnerThreadId;
+
+    // Only contended while the collector merges this shard
+    FCriticalSection Lock;
+    bool Touched[MaxMetrics];
+    int64 Counters[MaxMetrics];
+    double Gauges[MaxMetrics];
+    uint64 GaugeSequences[MaxMetrics];
+    // Allocated on a thread's first sample for the metric and reused after that
+    TUniquePtr<FHistogramValues> Histograms[MaxMetrics];
+};
+
+struct FGameLiftMetricsRegistry::FExportState
+{
+    FCriticalSection Lock;
+    TArray<TUniquePtr<IGameLiftMetricsExporter>> Exporters;
+};
+
+FGameLiftMetricsRegistry::FGameLiftMetricsRegistry() :
+    RegistryId(NextRegistryId.fetch_add(1, std::memory_order_relaxed)),
+    NumMetrics(0),
+    GaugeSequence(0),
+    ExportState(MakeShared<FExportState, ESPMode::ThreadSafe>())
+{
+}
+
+FGameLiftMetricsRegistry::~FGameLiftMetricsRegistry() = default;
+
+FGameLiftMetricHandle FGameLiftMetricsRegistry::Register(FName Name, EGameLiftMetricType Type)
+{
+    FGameLiftMetricHandle Handle;
+    {
+        FReadScopeLock ReadLock(MetricsLock);
+        if (const int32* Index = MetricIndices.Find(Name))
+        {
+            if (MetricTypes[*Index] == Type)
+            {
+                Handle.Index = *Index;
+            }
+            return Handle;
+        }
+    }
+
+    FWriteScopeLock WriteLock(MetricsLock);
+    if (const int32* Index = MetricIndices.Find(Name))
+    {
+        if (MetricTypes[*Index] == Type)
+        {
+            Handle.Index = *Index;
+        }
+        return Handle;
+    }
+
+    const int32 Index = NumMetrics.load(std::memory_order_relaxed);
+    if (Index >= MaxMetrics)
+    {
+        UE_LOG(GameLiftMetricsLog, Warning, TEXT("Metrics registry is full (%d), ignoring %s"), MaxMetrics, *Name.ToString());
+        return Handle;
+    }
+
+    MetricNames[Index] = Name;
+    MetricTypes[Index] = Type;
+    MetricIndices.Add(Name, Index);
+    // Publishes the name and type to collectors, which read them without the lock
+    NumMetrics.store(Index + 1, std::memory_order_release);
+
+    Handle.Index = Index;
+    return Handle;
+}
+
+void FGameLiftMetricsRegistry::AddCounter(FGameLiftMetricHandle Handle, int64 Delta)
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+
+    FShard& Shard = GetShard();
+    FScopeLock Lock(&Shard.Lock);
+    Shard.Counters[Handle.Index] += Delta;
+    Shard.Touched[Handle.Index] = true;
+}
+
+void FGameLiftMetricsRegistry::SetGauge(FGameLiftMetricHandle Handle, double Value)
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+
+    const uint64 Sequence = GaugeSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+    FShard& Shard = GetShard();
+    FScopeLock Lock(&Shard.Lock);
+    Shard.Gauges[Handle.Index] = Value;
+    Shard.GaugeSequences[Handle.Index] = Sequence;
+    Shard.Touched[Handle.Index] = true;
+}
+
+void FGameLiftMetricsRegistry::RecordHistogram(FGameLiftMetricHandle Handle, double Value)
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+
+    FShard& Shard = GetShard();
+    FScopeLock Lock(&Shard.Lock);
+    TUniquePtr<FShard::FHistogramValues>& Values = Shard.Histograms[Handle.Index];
+    if (!Values.IsValid())
+    {
+        Values = MakeUnique<FShard::FHistogramValues>();
+    }
+
+    const bool bFirstSample = Values->Histogram.GetCount() == 0;
+    Values->Histogram.Record((uint32)FMath::Clamp(Value * HistogramScale, 0.0, (double)MAX_uint32));
+    Values->Sum += Value;
+    Values->Min = bFirstSample ? Value : FMath::Min(Values->Min, Value);
+    Values->Max = bFirstSample ? Value : FMath::Max(Values->Max, Value);
+    Shard.Touched[Handle.Index] = true;
+}
+
+void FGameLiftMetricsRegistry::AddExporter(TUniquePtr<IGameLiftMetricsExporter> Exporter)
+{
+    UE_LOG(GameLiftMetricsLog, Log, TEXT("Exporting metrics to %s"), Exporter->GetName());
+
+    FScopeLock Lock(&ExportState->Lock);
+    ExportState->Exporters.Add(MoveTemp(Exporter));
+}
+
+bool FGameLiftMetricsRegistry::HasExporters() const
+{
+    FScopeLock Lock(&ExportState->Lock);
+    return ExportState->Exporters.Num() > 0;
+}
+
+TArray<FGameLiftMetricSample> FGameLiftMetricsRegistry::Collect()
+{
+    const int32 MetricCount = NumMetrics.load(std::memory_order_acquire);
+
+    struct FMerged
+    {
+        bool bTouched = false;
+        int64 Counter = 0;
+        double Gauge = 0.0;
+        uint64 GaugeSequence = 0;
+        TUniquePtr<FShard::FHistogramValues> Histogram;
+    };
+    TArray<FMerged> Merged;
+    Merged.SetNum(MetricCount);
+
+    {
+        FScopeLock ShardsScope(&ShardsLock);
+        for (const TUniquePtr<FShard>& Shard : Shards)
+        {
+            FScopeLock ShardScope(&Shard->Lock);
+            for (int32 Index = 0; Index < MetricCount; ++Index)
+            {
+                if (!Shard->Touched[Index])
+                {
+                    continue;
+                }
+                FMerged& Metric = Merged[Index];
+                Metric.bTouched = true;
+
+                switch (MetricTypes[Index])
+                {
+                case EGameLiftMetricType::Counter:
+                    Metric.Counter += Shard->Counters[Index];
+                    Shard->Counters[Index] = 0;
+                    break;
+
+                case EGameLiftMetricType::Gauge:
+                    if (Shard->GaugeSequences[Index] > Metric.GaugeSequence)
+                    {
+                        Metric.Gauge = Shard->Gauges[Index];
+                        Metric.GaugeSequence = Shard->GaugeSequences[Index];
+                    }
+                    break;
+
+                case EGameLiftMetricType::Histogram:
+                {
+                    FShard::FHistogramValues& Values = *Shard->Histograms[Index];
+                    if (!Metric.Histogram.IsValid())
+                    {
+                        Metric.Histogram = MakeUnique<FShard::FHistogramValues>(Values);
+                    }
+                    else
+                    {
+                        Metric.Histogram->Histogram.Merge(Values.Histogram);
+                        Metric.Histogram->Sum += Values.Sum;
+                        Metric.Histogram->Min = FMath::Min(Metric.Histogram->Min, Values.Min);
+                        Metric.Histogram->Max = FMath::Max(Metric.Histogram->Max, Values.Max);
+                    }
+                    Values.Histogram.Reset();
+                    Values.Sum = 0.0;
+                    break;
+                }
+                }
+                Shard->Touched[Index] = false;
+            }
+        }
+    }
+
+    TArray<FGameLiftMetricSample> Samples;
+    for (int32 Index = 0; Index < MetricCount; ++Index)
+    {
+        const FMerged& Metric = Merged[Index];
+        if (!Metric.bTouched)
+        {
+            continue;
+        }
+
+        FGameLiftMetricSample& Sample = Samples.AddDefaulted_GetRef();
+        Sample.Name = MetricNames[Index];
+        Sample.Type = MetricTypes[Index];
+        switch (Sample.Type)
+        {
+        case EGameLiftMetricType::Counter:
+            Sample.Value = (double)Metric.Counter;
+            break;
+
+        case EGameLiftMetricType::Gauge:
+            Sample.Value = Metric.Gauge;
+            break;
+
+        case EGameLiftMetricType::Histogram:
+        {
+            const FGameLiftLatencyHistogram& Histogram = Metric.Histogram->Histogram;
+            Sample.Count = Histogram.GetCount();
+            Sample.Sum = Metric.Histogram->Sum;
+            Sample.Min = Metric.Histogram->Min;
+            Sample.Max = Metric.Histogram->Max;
+            // Bucket bounds can overshoot the largest sample; the exact max is known
+            Sample.P50 = FMath::Min(Histogram.GetPercentile(0.50) / HistogramScale, Sample.Max);
+            Sample.P95 = FMath::Min(Histogram.GetPercentile(0.95) / HistogramScale, Sample.Max);
+            Sample.P99 = FMath::Min(Histogram.GetPercentile(0.99) / HistogramScale, Sample.Max);
+            break;
+        }
+        }
+    }
+    return Samples;
+}
+
+void FGameLiftMetricsRegistry::Flush()
+{
+    if (!HasExporters())
+    {
+        return;
+    }
+
+    TArray<FGameLiftMetricSample> Samples = Collect();
+    if (Samples.Num() == 0)
+    {
+        return;
+    }
+
+    // The export state outlives the registry if this task is still queued when the game mode goes away
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+        [State = ExportState, Samples = MoveTemp(Samples), Timestamp = FDateTime::UtcNow()]()
+    {
+        FScopeLock Lock(&State->Lock);
+        for (const TUniquePtr<IGameLiftMetricsExporter>& Exporter : State->Exporters)
+        {
+            Exporter->Export(Samples, Timestamp);
+        }
+    });
+}
+
+FGameLiftMetricsRegistry::FShard& FGameLiftMetricsRegistry::GetShard()
+{
+    if (CachedShard.RegistryId == RegistryId)
+    {
+        return *static_cast<FShard*>(CachedShard.Shard);
+    }
+
+    // First sample from this thread, or the thread last recorded into another registry
+    const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+    FScopeLock Lock(&ShardsLock);
+
+    FShard* Shard = nullptr;
+    for (const TUniquePtr<FShard>& Existing : Shards)
+    {
+        if (Existing->OwnerThreadId == ThreadId)
+        {
+            Shard = Existing.Get();
+            break;
+        }
+    }
+    if (!Shard)
+    {
+        Shard = Shards.Add_GetRef(MakeUnique<FShard>(ThreadId)).Get();
+    }
+
+    CachedShard.RegistryId = RegistryId;
+    CachedShard.Shard = Shard;
+    return *Shard;
+}
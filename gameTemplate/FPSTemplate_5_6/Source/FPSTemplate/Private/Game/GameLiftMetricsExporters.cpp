@@ -0,0 +1,221 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/GameLiftMetricsExporters.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+DEFINE_LOG_CATEGORY_STATIC(GameLiftMetricsExportLog, Log, All);
+
+namespace
+{
+    FString FormatMetricValue(double Value)
+    {
+        return FString::Printf(TEXT("%.6g"), Value);
+    }
+
+    // Histograms are flattened into one named value per statistic for both exporters
+    void FlattenHistogram(const FGameLiftMetricSample& Sample, TArray<TPair<FString, double>>& OutValues)
+    {
+        const FString Name = Sample.Name.ToString();
+        OutValues.Emplace(Name + TEXT(".p50"), Sample.P50);
+        OutValues.Emplace(Name + TEXT(".p95"), Sample.P95);
+        OutValues.Emplace(Name + TEXT(".p99"), Sample.P99);
+        OutValues.Emplace(Name + TEXT(".max"), Sample.Max);
+        OutValues.Emplace(Name + TEXT(".min"), Sample.Min);
+        OutValues.Emplace(Name + TEXT(".mean"), Sample.Count > 0 ? Sample.Sum / Sample.Count : 0.0);
+    }
+
+    FString EscapeJson(const FString& Value)
+    {
+        return Value.ReplaceCharWithEscapedChar();
+    }
+}
+
+FGameLiftStatsDExporter::FGameLiftStatsDExporter(const FString& InHost, int32 InPort, const FString& InPrefix) :
+    Host(InHost),
+    Port(InPort),
+    Prefix(InPrefix.IsEmpty() ? FString() : InPrefix + TEXT(".")),
+    Socket(nullptr),
+    bResolveFailed(false)
+{
+}
+
+FGameLiftStatsDExporter::~FGameLiftStatsDExporter()
+{
+    if (Socket)
+    {
+        Socket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+    }
+}
+
+bool FGameLiftStatsDExporter::EnsureSocket()
+{
+    if (Socket)
+    {
+        return true;
+    }
+    if (bResolveFailed)
+    {
+        return false;
+    }
+
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    const FAddressInfoResult Resolved = SocketSubsystem->GetAddressInfo(*Host, nullptr,
+        EAddressInfoFlags::Default, NAME_None, ESocketType::SOCKTYPE_Datagram);
+    if (Resolved.ReturnCode != SE_NO_ERROR || Resolved.Results.Num() == 0)
+    {
+        UE_LOG(GameLiftMetricsExportLog, Warning, TEXT("Could not resolve StatsD host %s, StatsD export disabled"), *Host);
+        bResolveFailed = true;
+        return false;
+    }
+
+    Address = Resolved.Results[0].Address;
+    Address->SetPort(Port);
+    Socket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("GameLiftStatsD"), Address->GetProtocolType());
+    if (!Socket)
+    {
+        UE_LOG(GameLiftMetricsExportLog, Warning, TEXT("Could not create StatsD socket, StatsD export disabled"));
+        bResolveFailed = true;
+        return false;
+    }
+    Socket->SetNonBlocking(true);
+    return true;
+}
+
+void FGameLiftStatsDExporter::Export(const TArray<FGameLiftMetricSample>& Samples, const FDateTime& Timestamp)
+{
+    if (!EnsureSocket())
+    {
+        return;
+    }
+
+    TArray<ANSICHAR> Packet;
+    Packet.Reserve(MaxPacketBytes);
+
+    for (const FGameLiftMetricSample& Sample : Samples)
+    {
+        const FString Name = Prefix + Sample.Name.ToString();
+        switch (Sample.Type)
+        {
+        case EGameLiftMetricType::Counter:
+            AppendLine(Packet, FString::Printf(TEXT("%s:%s|c"), *Name, *FormatMetricValue(Sample.Value)));
+            break;
+
+        case EGameLiftMetricType::Gauge:
+            // A signed gauge value is a relative change in StatsD; zero it first to set a negative value
+            if (Sample.Value < 0.0)
+            {
+                AppendLine(Packet, FString::Printf(TEXT("%s:0|g"), *Name));
+            }
+            AppendLine(Packet, FString::Printf(TEXT("%s:%s|g"), *Name, *FormatMetricValue(Sample.Value)));
+            break;
+
+        case EGameLiftMetricType::Histogram:
+        {
+            TArray<TPair<FString, double>> Values;
+            FlattenHistogram(Sample, Values);
+            for (const TPair<FString, double>& Value : Values)
+            {
+                AppendLine(Packet, FString::Printf(TEXT("%s%s:%s|g"), *Prefix, *Value.Key, *FormatMetricValue(Value.Value)));
+            }
+            AppendLine(Packet, FString::Printf(TEXT("%s.count:%llu|c"), *Name, Sample.Count));
+            break;
+        }
+        }
+    }
+
+    SendPacket(Packet);
+}
+
+void FGameLiftStatsDExporter::AppendLine(TArray<ANSICHAR>& Packet, const FString& Line)
+{
+    const FTCHARToUTF8 Utf8Line(*Line);
+    const int32 Separator = Packet.Num() > 0 ? 1 : 0;
+    if (Packet.Num() + Separator + Utf8Line.Length() > MaxPacketBytes)
+    {
+        SendPacket(Packet);
+    }
+
+    if (Packet.Num() > 0)
+    {
+        Packet.Add('\n');
+    }
+    Packet.Append(reinterpret_cast<const ANSICHAR*>(Utf8Line.Get()), Utf8Line.Length());
+}
+
+void FGameLiftStatsDExporter::SendPacket(TArray<ANSICHAR>& Packet)
+{
+    if (Packet.Num() == 0)
+    {
+        return;
+    }
+
+    int32 BytesSent = 0;
+    if (!Socket->SendTo(reinterpret_cast<const uint8*>(Packet.GetData()), Packet.Num(), BytesSent, *Address))
+    {
+        // UDP to a local agent; a lost interval is not worth retrying
+        UE_LOG(GameLiftMetricsExportLog, Verbose, TEXT("StatsD send of %d bytes failed"), Packet.Num());
+    }
+    Packet.Reset();
+}
+
+FGameLiftEmfFileExporter::FGameLiftEmfFileExporter(const FString& InFilePath, const FString& InNamespace, const TMap<FString, FString>& InProperties) :
+    FilePath(InFilePath),
+    Namespace(InNamespace)
+{
+    for (const TPair<FString, FString>& Property : InProperties)
+    {
+        PropertiesJson += FString::Printf(TEXT(",\"%s\":\"%s\""), *EscapeJson(Property.Key), *EscapeJson(Property.Value));
+    }
+}
+
+void FGameLiftEmfFileExporter::Export(const TArray<FGameLiftMetricSample>& Samples, const FDateTime& Timestamp)
+{
+    TArray<TPair<FString, double>> Values;
+    for (const FGameLiftMetricSample& Sample : Samples)
+    {
+        if (Sample.Type == EGameLiftMetricType::Histogram)
+        {
+            FlattenHistogram(Sample, Values);
+            Values.Emplace(Sample.Name.ToString() + TEXT(".count"), (double)Sample.Count);
+        }
+        else
+        {
+            Values.Emplace(Sample.Name.ToString(), Sample.Value);
+        }
+    }
+
+    const int64 TimestampMillis = (Timestamp - FDateTime(1970, 1, 1)).GetTicks() / ETimespan::TicksPerMillisecond;
+
+    FString Lines;
+    for (int32 First = 0; First < Values.Num(); First += MaxMetricsPerDocument)
+    {
+        const int32 Last = FMath::Min(First + MaxMetricsPerDocument, Values.Num());
+
+        FString Definitions;
+        FString MetricValues;
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            const FString Name = EscapeJson(Values[Index].Key);
+            Definitions += FString::Printf(TEXT("%s{\"Name\":\"%s\"}"), Index > First ? TEXT(",") : TEXT(""), *Name);
+            MetricValues += FString::Printf(TEXT(",\"%s\":%s"), *Name, *FormatMetricValue(Values[Index].Value));
+        }
+
+        Lines += FString::Printf(
+            TEXT("{\"_aws\":{\"Timestamp\":%lld,\"CloudWatchMetrics\":[{\"Namespace\":\"%s\",\"Dimensions\":[[]],\"Metrics\":[%s]}]}%s%s}\n"),
+            TimestampMillis, *EscapeJson(Namespace), *Definitions, *PropertiesJson, *MetricValues);
+    }
+
+    if (!Lines.IsEmpty() &&
+        !FFileHelper::SaveStringToFile(Lines, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+            &IFileManager::Get(), FILEWRITE_Append))
+    {
+        UE_LOG(GameLiftMetricsExportLog, Warning, TEXT("Could not append metrics to %s"), *FilePath);
+    }
+}
@@ -0,0 +1,211 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/GameLiftWorldPrewarm.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(GameLiftWorldPrewarmLog, Log, All);
+
+FGameLiftWorldPrewarm::FGameLiftWorldPrewarm() :
+    NextWaiterId(0),
+    PendingLoads(0),
+    ResidentAssets(0)
+{
+}
+
+FGameLiftWorldPrewarm::~FGameLiftWorldPrewarm()
+{
+    // Completion and deadline delegates are bound raw to this object
+    Reset();
+}
+
+void FGameLiftWorldPrewarm::Request(const TCHAR* Stage, const TArray<FSoftObjectPath>& Assets)
+{
+    FStage& StageState = Stages.FindOrAdd(FString(Stage));
+
+    int32 NumNewAssets = 0;
+    for (const FSoftObjectPath& AssetPath : Assets)
+    {
+        if (AssetPath.IsValid() && !StageState.Assets.Contains(AssetPath))
+        {
+            StageState.Assets.Add(AssetPath);
+            ++NumNewAssets;
+        }
+    }
+
+    if (NumNewAssets == 0)
+    {
+        UE_LOG(GameLiftWorldPrewarmLog, Verbose, TEXT("%s assets already requested"), Stage);
+        return;
+    }
+
+    UE_LOG(GameLiftWorldPrewarmLog, Log, TEXT("Prewarming %d %s assets (%d new)"), StageState.Assets.Num(), Stage, NumNewAssets);
+
+    // The new handle covers the whole stage; the old one is let go only once it is in place, so
+    // assets it already holds stay resident, and a cancelled load never calls its delegate
+    TSharedPtr<FStreamableHandle> PreviousHandle = MoveTemp(StageState.Handle);
+    if (!StageState.bLoading)
+    {
+        // Counted before the request: the delegate may run inside RequestAsyncLoad if everything is resident
+        StageState.bLoading = true;
+        StageState.StartSeconds = FPlatformTime::Seconds();
+        ++PendingLoads;
+    }
+
+    TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        StageState.Assets,
+        FStreamableDelegate::CreateRaw(this, &FGameLiftWorldPrewarm::HandleLoadComplete, FString(Stage)));
+
+    if (PreviousHandle.IsValid())
+    {
+        if (PreviousHandle->IsLoadingInProgress())
+        {
+            PreviousHandle->CancelHandle();
+        }
+        else
+        {
+            PreviousHandle->ReleaseHandle();
+        }
+    }
+
+    // A waiter run from inside the delegate may have requested another stage or reset the prewarm
+    FStage* RequestedStage = Stages.Find(FString(Stage));
+    if (!RequestedStage)
+    {
+        if (Handle.IsValid())
+        {
+            Handle->ReleaseHandle();
+        }
+        return;
+    }
+
+    if (Handle.IsValid())
+    {
+        RequestedStage->Handle = Handle;
+    }
+    else if (RequestedStage->bLoading)
+    {
+        UE_LOG(GameLiftWorldPrewarmLog, Warning, TEXT("No %s assets could be resolved for prewarm"), Stage);
+        RequestedStage->bLoading = false;
+        FinishLoad();
+    }
+}
+
+void FGameLiftWorldPrewarm::WhenComplete(float TimeoutSeconds, TUniqueFunction<void()> Callback)
+{
+    if (IsComplete())
+    {
+        Callback();
+        return;
+    }
+
+    FWaiter& Waiter = Waiters.AddDefaulted_GetRef();
+    Waiter.Id = NextWaiterId++;
+    Waiter.Callback = MoveTemp(Callback);
+    if (TimeoutSeconds > 0.0f)
+    {
+        Waiter.DeadlineHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FGameLiftWorldPrewarm::HandleWaiterDeadline, Waiter.Id, TimeoutSeconds),
+            TimeoutSeconds);
+    }
+}
+
+void FGameLiftWorldPrewarm::Reset()
+{
+    for (TPair<FString, FStage>& Stage : Stages)
+    {
+        const TSharedPtr<FStreamableHandle>& Handle = Stage.Value.Handle;
+        if (!Handle.IsValid())
+        {
+            continue;
+        }
+
+        if (Handle->IsLoadingInProgress())
+        {
+            Handle->CancelHandle();
+        }
+        else
+        {
+            Handle->ReleaseHandle();
+        }
+    }
+    Stages.Empty();
+
+    for (const FWaiter& Waiter : Waiters)
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(Waiter.DeadlineHandle);
+    }
+    Waiters.Empty();
+
+    PendingLoads = 0;
+    ResidentAssets = 0;
+}
+
+void FGameLiftWorldPrewarm::HandleLoadComplete(FString StageName)
+{
+    FStage* Stage = Stages.Find(StageName);
+    if (!Stage || !Stage->bLoading)
+    {
+        return;
+    }
+
+    UE_LOG(GameLiftWorldPrewarmLog, Log, TEXT("%s prewarm finished: %d assets in %.3f s"),
+        *StageName, Stage->Assets.Num(), FPlatformTime::Seconds() - Stage->StartSeconds);
+
+    // Only assets the stage did not already hold are added
+    ResidentAssets += Stage->Assets.Num() - Stage->NumResident;
+    Stage->NumResident = Stage->Assets.Num();
+    Stage->bLoading = false;
+    FinishLoad();
+}
+
+bool FGameLiftWorldPrewarm::HandleWaiterDeadline(float DeltaTime, int32 WaiterId, float TimeoutSeconds)
+{
+    const int32 WaiterIndex = Waiters.IndexOfByPredicate([WaiterId](const FWaiter& Waiter) { return Waiter.Id == WaiterId; });
+    if (WaiterIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const double NowSeconds = FPlatformTime::Seconds();
+    TArray<FString> LateStages;
+    for (const TPair<FString, FStage>& Stage : Stages)
+    {
+        if (Stage.Value.bLoading)
+        {
+            LateStages.Add(FString::Printf(TEXT("%s (%d assets, %.1f s)"),
+                *Stage.Key, Stage.Value.Assets.Num(), NowSeconds - Stage.Value.StartSeconds));
+        }
+    }
+    UE_LOG(GameLiftWorldPrewarmLog, Warning, TEXT("Prewarm still loading after %.1f s, continuing without: %s"),
+        TimeoutSeconds, *FString::Join(LateStages, TEXT(", ")));
+
+    // The late loads carry on and stay resident; only this waiter stops waiting for them
+    TUniqueFunction<void()> Callback = MoveTemp(Waiters[WaiterIndex].Callback);
+    Waiters.RemoveAt(WaiterIndex);
+    Callback();
+    return false;
+}
+
+void FGameLiftWorldPrewarm::FinishLoad()
+{
+    if (--PendingLoads > 0)
+    {
+        return;
+    }
+
+    // A waiter may request more loads, so run the ones registered up to now from a local copy
+    TArray<FWaiter> ReadyWaiters = MoveTemp(Waiters);
+    Waiters.Reset();
+    for (FWaiter& Waiter : ReadyWaiters)
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(Waiter.DeadlineHandle);
+    }
+    for (FWaiter& Waiter : ReadyWaiters)
+    {
+        Waiter.Callback();
+    }
+}
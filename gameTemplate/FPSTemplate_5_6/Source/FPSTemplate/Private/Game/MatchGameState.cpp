@@ -70,6 +70,16 @@ bool AMatchGameState::IsTiedForTheLead(AMatchPlayerState* PlayerState)
 	return false;
 }
 
+void AMatchGameState::Reset()
+{
+	Super::Reset();
+
+	// Back to a fresh match when a recycled server hosts its next session
+	Leaders.Empty();
+	SortedPlayerStates.Empty();
+	bHasFirstBloodBeenHad = false;
+}
+
 void AMatchGameState::BeginPlay()
 {
 	Super::BeginPlay();
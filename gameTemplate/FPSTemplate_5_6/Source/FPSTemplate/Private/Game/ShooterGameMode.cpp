@@ -2,18 +2,30 @@
 
 
 #include "Game/ShooterGameMode.h"
+#include "Game/GameLiftMetricsExporters.h"
 
 #include "UObject/ConstructorHelpers.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/GameSession.h"
 #include "GameFramework/PlayerState.h"
+#include "GameFramework/Pawn.h"
+#include "EngineUtils.h"
 #include "GenericPlatform/GenericPlatformMemory.h"
 #include "HAL/PlatformFileManager.h"
 #include "Misc/DateTime.h"
 #include "Misc/CommandLine.h"
 #include "Misc/Parse.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Async/Async.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/FileManager.h"
+#include "ProfilingDebugging/MiscTrace.h"
 
 #if WITH_GAMELIFT
 #include "GameLiftServerSDK.h"
@@ -22,8 +34,69 @@
 
 DEFINE_LOG_CATEGORY(GameServerLog);
 
+#if WITH_GAMELIFT
+namespace
+{
+    void AppendPrewarmSet(const FGameLiftPrewarmSet& Set, TArray<FSoftObjectPath>& OutAssets)
+    {
+        // Montages referenced by the weapon data and classes come in with them as hard references
+        for (const TSoftObjectPtr<UWeaponData>& WeaponData : Set.WeaponData)
+        {
+            OutAssets.Add(WeaponData.ToSoftObjectPath());
+        }
+        for (const TSoftClassPtr<AWeapon>& WeaponClass : Set.WeaponClasses)
+        {
+            OutAssets.Add(WeaponClass.ToSoftObjectPath());
+        }
+        for (const TSoftObjectPtr<UAnimMontage>& Montage : Set.Montages)
+        {
+            OutAssets.Add(Montage.ToSoftObjectPath());
+        }
+        for (const TSoftClassPtr<APawn>& PlayerClass : Set.PlayerClasses)
+        {
+            OutAssets.Add(PlayerClass.ToSoftObjectPath());
+        }
+    }
+}
+#endif
+
+FGameLiftServerMetricHandles::FGameLiftServerMetricHandles(FGameLiftMetricsRegistry& Registry) :
+    TickRate(Registry.Register(TEXT("TickRate"), EGameLiftMetricType::Gauge)),
+    MemoryUsage(Registry.Register(TEXT("MemoryUsage"), EGameLiftMetricType::Gauge)),
+    PlayerCount(Registry.Register(TEXT("PlayerCount"), EGameLiftMetricType::Gauge)),
+    HitchCount(Registry.Register(TEXT("HitchCount"), EGameLiftMetricType::Gauge)),
+    FrameTimeP50Ms(Registry.Register(TEXT("FrameTimeP50Ms"), EGameLiftMetricType::Gauge)),
+    FrameTimeP95Ms(Registry.Register(TEXT("FrameTimeP95Ms"), EGameLiftMetricType::Gauge)),
+    FrameTimeP99Ms(Registry.Register(TEXT("FrameTimeP99Ms"), EGameLiftMetricType::Gauge)),
+    FrameTimeMaxMs(Registry.Register(TEXT("FrameTimeMaxMs"), EGameLiftMetricType::Gauge)),
+    FrameWorkMs(Registry.Register(TEXT("FrameWorkMs"), EGameLiftMetricType::Gauge)),
+    FrameIdleMs(Registry.Register(TEXT("FrameIdleMs"), EGameLiftMetricType::Gauge)),
+    FrameSdkCommandsMs(Registry.Register(TEXT("FrameSdkCommandsMs"), EGameLiftMetricType::Gauge)),
+    MatchFrameTimeP99Ms(Registry.Register(TEXT("MatchFrameTimeP99Ms"), EGameLiftMetricType::Gauge)),
+    MatchFrameTimeMaxMs(Registry.Register(TEXT("MatchFrameTimeMaxMs"), EGameLiftMetricType::Gauge)),
+    CommandQueueMaxDepth(Registry.Register(TEXT("CommandQueueMaxDepth"), EGameLiftMetricType::Gauge)),
+    CommandQueueMaxLatencyMs(Registry.Register(TEXT("CommandQueueMaxLatencyMs"), EGameLiftMetricType::Gauge)),
+    CommandQueueAvgLatencyMs(Registry.Register(TEXT("CommandQueueAvgLatencyMs"), EGameLiftMetricType::Gauge)),
+    LaunchToActiveMs(Registry.Register(TEXT("LaunchToActiveMs"), EGameLiftMetricType::Gauge)),
+    SessionStartToActiveMs(Registry.Register(TEXT("SessionStartToActiveMs"), EGameLiftMetricType::Gauge)),
+    RecycleMs(Registry.Register(TEXT("RecycleMs"), EGameLiftMetricType::Gauge)),
+    RecycleUsedMemoryMB(Registry.Register(TEXT("RecycleUsedMemoryMB"), EGameLiftMetricType::Gauge)),
+    HealthChecksPassed(Registry.Register(TEXT("HealthChecksPassed"), EGameLiftMetricType::Counter)),
+    HealthChecksFailed(Registry.Register(TEXT("HealthChecksFailed"), EGameLiftMetricType::Counter)),
+    Hitches(Registry.Register(TEXT("Hitches"), EGameLiftMetricType::Counter)),
+    SdkCallbacksDropped(Registry.Register(TEXT("SdkCallbacksDropped"), EGameLiftMetricType::Counter)),
+    PlayersJoined(Registry.Register(TEXT("PlayersJoined"), EGameLiftMetricType::Counter)),
+    PlayersLeft(Registry.Register(TEXT("PlayersLeft"), EGameLiftMetricType::Counter)),
+    SdkProcessReadyMs(Registry.Register(TEXT("SdkProcessReadyMs"), EGameLiftMetricType::Histogram)),
+    SdkActivateGameSessionMs(Registry.Register(TEXT("SdkActivateGameSessionMs"), EGameLiftMetricType::Histogram)),
+    SdkAcceptPlayerSessionMs(Registry.Register(TEXT("SdkAcceptPlayerSessionMs"), EGameLiftMetricType::Histogram)),
+    SdkRemovePlayerSessionMs(Registry.Register(TEXT("SdkRemovePlayerSessionMs"), EGameLiftMetricType::Histogram))
+{
+}
+
 // Constructor
 AShooterGameMode::AShooterGameMode() :
+    GameThreadCommands(GAME_THREAD_COMMAND_CAPACITY),
     ServerState(EGameLiftServerState::Uninitialized),
     bIsGameLiftInitialized(false),
     bIsGameSessionActive(false),
@@ -32,19 +105,27 @@ AShooterGameMode::AShooterGameMode() :
     CurrentPlayerCount(0),
     MaxPlayers(0),
     LastTickTime(0.0f),
-    TickTimeAccumulator(0.0f),
-    TickCounter(0)
+    PublishedServerState(EGameLiftServerState::Uninitialized)
 #if WITH_GAMELIFT
     , ProcessParameters(nullptr)
     , GameLiftModule(nullptr)
 #endif
     , ConsecutiveInitFailures(0)
+    , StartupSignals(EGameLiftStartupSignal::None)
+    , bProcessReadyRequested(false)
+    , SessionStartRequestedSeconds(0.0)
+    , RecycleStartedSeconds(0.0)
+    , NumProcessReregistrations(0)
 {
     // For server builds, we don't need to set a specific pawn class
     // The default pawn class will be sufficient for GameLift functionality
     // static ConstructorHelpers::FClassFinder<APawn> PlayerPawnBPClass(TEXT("/Game/ThirdPerson/Blueprints/BP_ThirdPersonCharacter"));
     UE_LOG(GameServerLog, Log, TEXT("✅ GameMode constructor completed - using default pawn class"));
 
+    // Registered here rather than in the initializer list, since the generated vtable-helper
+    // constructor default-constructs every member
+    MetricHandles = FGameLiftServerMetricHandles(Metrics);
+
     // Enable ticking for health monitoring
     PrimaryActorTick.bCanEverTick = true;
     PrimaryActorTick.TickInterval = 0.0f; // Tick every frame
@@ -56,6 +137,12 @@ AShooterGameMode::AShooterGameMode() :
 void AShooterGameMode::BeginPlay()
 {
     Super::BeginPlay();
+    MarkStartupMilestone(TEXT("BeginPlay"));
+
+    FrameTimes.SetHitchThresholds(ServerConfig.HitchThresholdsMs);
+
+    // Give the health callback something to read before the first statistics update
+    PublishHealthSnapshot(FGameLiftFrameTimeSummary());
 
     // Initialize server statistics
 #if WITH_GAMELIFT
@@ -64,6 +151,7 @@ void AShooterGameMode::BeginPlay()
 
     // Parse command line arguments first
     ParseCommandLineArguments();
+    ConfigureMetricsExporters();
 
     // Validate configuration
     if (!ValidateServerConfiguration())
@@ -125,12 +213,17 @@ void AShooterGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
     // Clear all timers
     GetWorldTimerManager().ClearTimer(HealthCheckTimerHandle);
     GetWorldTimerManager().ClearTimer(StatisticsUpdateTimerHandle);
+    GetWorldTimerManager().ClearTimer(MetricsFlushTimerHandle);
 #if WITH_GAMELIFT
     GetWorldTimerManager().ClearTimer(RetryInitTimerHandle);
 
     // Perform cleanup
     ShutdownGameLift();
 #endif
+    WorldPrewarm.Reset();
+
+    // Whatever was recorded since the last interval
+    Metrics.Flush();
 
     Super::EndPlay(EndPlayReason);
 }
@@ -140,12 +233,25 @@ void AShooterGameMode::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
 
-    // Update tick rate calculation
-    TickTimeAccumulator += DeltaSeconds;
-    TickCounter++;
+    // Run work handed over by SDK callbacks
+    const double CommandsStartSeconds = FPlatformTime::Seconds();
+    GameThreadCommands.Drain(GAME_THREAD_COMMAND_BUDGET_SECONDS);
+    const double SdkCommandSeconds = FPlatformTime::Seconds() - CommandsStartSeconds;
+
+    // Real frame time, unaffected by time dilation; idle is the wait for the server frame rate cap
+    FrameTimes.RecordFrame(FApp::GetDeltaTime(), FApp::GetIdleTime(), SdkCommandSeconds);
 
     // Track last tick time for health monitoring
     LastTickTime = GetWorld()->GetTimeSeconds();
+
+#if WITH_GAMELIFT
+    // World readiness is one of the start-up signals ProcessReady waits for
+    if (!EnumHasAnyFlags(StartupSignals, EGameLiftStartupSignal::WorldReady) &&
+        ServerState == EGameLiftServerState::Initializing && IsGameWorldReady())
+    {
+        MarkStartupSignal(EGameLiftStartupSignal::WorldReady);
+    }
+#endif
 }
 
 #if WITH_GAMELIFT
@@ -183,6 +289,9 @@ void AShooterGameMode::InitGameLift()
         return;
     }
 
+    // Everything ProcessReady waits on starts at once; MarkStartupSignal sends it when the last one lands
+    StartStartupPrewarm();
+
     UE_LOG(GameServerLog, Log, TEXT("🔄 Starting GameLift initialization with retry logic"));
     InitGameLiftWithRetry(0);
 }
@@ -218,12 +327,31 @@ void AShooterGameMode::InitGameLiftWithRetry(int32 AttemptNumber)
         UE_LOG(GameServerLog, Warning, TEXT("⚠️ Not a GameLift Anywhere fleet - using default parameters"));
     }
 
-    // Attempt initialization
+    // Attempt initialization. InitSDK blocks on the websocket connect (TLS handshake and, on
+    // Anywhere fleets, request signing), so it runs on a background thread while the world and
+    // the rest of the start-up prewarm carry on.
     UE_LOG(GameServerLog, Log, TEXT("🔄 Attempting GameLift SDK initialization (attempt %d/%d)..."),
         AttemptNumber + 1, ServerConfig.MaxRetryAttempts);
     UE_LOG(GameServerLog, Log, TEXT("   - GameLiftModule valid: %s"), GameLiftModule ? TEXT("YES") : TEXT("NO"));
+    MarkStartupMilestone(TEXT("SdkInitStarted"));
 
-    FGameLiftGenericOutcome InitOutcome = GameLiftModule->InitSDK(ServerParameters);
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    FGameLiftServerSDKModule* Module = GameLiftModule;
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, Module, ServerParameters, AttemptNumber]()
+    {
+        FGameLiftGenericOutcome InitOutcome = Module->InitSDK(ServerParameters);
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, InitOutcome = MoveTemp(InitOutcome), AttemptNumber]()
+        {
+            if (AShooterGameMode* GameMode = WeakThis.Get())
+            {
+                GameMode->HandleSdkInitialized(InitOutcome, AttemptNumber);
+            }
+        });
+    });
+}
+
+void AShooterGameMode::HandleSdkInitialized(const FGameLiftGenericOutcome& InitOutcome, int32 AttemptNumber)
+{
     UE_LOG(GameServerLog, Log, TEXT("📞 InitSDK call completed"));
 
     if (InitOutcome.IsSuccess())
@@ -232,63 +360,10 @@ void AShooterGameMode::InitGameLiftWithRetry(int32 AttemptNumber)
         LastInitAttemptTime = FDateTime::Now();
         ConsecutiveInitFailures = 0;
 
-        // Setup callbacks and complete initialization
+        // Setup callbacks; ProcessReady goes out as soon as every other start-up signal is in
         UE_LOG(GameServerLog, Log, TEXT("🔗 Setting up GameLift callbacks"));
         SetupGameLiftCallbacks();
-
-        // DELAY ProcessReady to allow SDK to fully initialize
-        // The SDK initialization is asynchronous internally and needs time to complete
-        UE_LOG(GameServerLog, Log, TEXT("⏰ Setting timer for ProcessReady call (2.0 second delay)"));
-        GetWorldTimerManager().SetTimer(
-            RetryInitTimerHandle,
-            [this]() {
-                UE_LOG(GameServerLog, Log, TEXT("🕐 Timer fired - Calling ProcessReady after SDK initialization delay..."));
-                
-                // Check if GameLift module is still valid
-                if (!GameLiftModule)
-                {
-                    UE_LOG(GameServerLog, Error, TEXT("❌ GameLift module is null, cannot call ProcessReady"));
-                    TransitionToState(EGameLiftServerState::Error);
-                    return;
-                }
-                
-                // Call ProcessReady
-                UE_LOG(GameServerLog, Log, TEXT("📦 Creating FProcessParameters"));
-                ProcessParameters = MakeShared<FProcessParameters>();
-
-                // Set port
-                ProcessParameters->port = ServerConfig.ServerPort;
-                UE_LOG(GameServerLog, Log, TEXT("🔌 Set port: %d"), ServerConfig.ServerPort);
-
-                // Setup log files
-                TArray<FString> LogFiles;
-                LogFiles.Add(ServerConfig.LogDirectory + TEXT("server.log"));
-                LogFiles.Append(ServerConfig.AdditionalLogFiles);
-                ProcessParameters->logParameters = LogFiles;
-                UE_LOG(GameServerLog, Log, TEXT("📝 Configured log files: %d files"), LogFiles.Num());
-
-                // Call ProcessReady
-                UE_LOG(GameServerLog, Log, TEXT("📞 Calling ProcessReady..."));
-                FGameLiftGenericOutcome ProcessReadyOutcome = GameLiftModule->ProcessReady(*ProcessParameters);
-                UE_LOG(GameServerLog, Log, TEXT("📞 ProcessReady call completed"));
-
-                if (ProcessReadyOutcome.IsSuccess())
-                {
-                    UE_LOG(GameServerLog, Log, TEXT("✅ ProcessReady successful. Server is ready to host game sessions."));
-                    bIsGameLiftInitialized = true;
-                    TransitionToState(EGameLiftServerState::Ready);
-                }
-                else
-                {
-                    FGameLiftError Error = ProcessReadyOutcome.GetError();
-                    LastErrorMessage = Error.m_errorMessage;
-                    UE_LOG(GameServerLog, Error, TEXT("❌ ProcessReady failed: %s"), *LastErrorMessage);
-                    TransitionToState(EGameLiftServerState::Error);
-                }
-            },
-            2.0f, // 2 second delay to allow SDK to fully initialize
-            false
-        );
+        MarkStartupSignal(EGameLiftStartupSignal::SdkConnected);
     }
     else
     {
@@ -316,6 +391,169 @@ void AShooterGameMode::InitGameLiftWithRetry(int32 AttemptNumber)
     }
 }
 
+void AShooterGameMode::StartStartupPrewarm()
+{
+    // Log directory: created off the game thread so the first SDK log write does not pay for it
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    const FString LogDirectory = ServerConfig.LogDirectory;
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, LogDirectory]()
+    {
+        if (!IFileManager::Get().MakeDirectory(*LogDirectory, true))
+        {
+            UE_LOG(GameServerLog, Warning, TEXT("Could not create log directory %s"), *LogDirectory);
+        }
+        AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+        {
+            if (AShooterGameMode* GameMode = WeakThis.Get())
+            {
+                GameMode->MarkStartupSignal(EGameLiftStartupSignal::LogsReady);
+            }
+        });
+    });
+
+    // Assets: streamed in the background and kept resident by the handle
+    TArray<FSoftObjectPath> AssetsToLoad;
+    for (const FSoftObjectPath& AssetPath : ServerConfig.StartupPrewarmAssets)
+    {
+        if (AssetPath.IsValid())
+        {
+            AssetsToLoad.Add(AssetPath);
+        }
+    }
+
+    if (AssetsToLoad.Num() == 0)
+    {
+        MarkStartupSignal(EGameLiftStartupSignal::AssetsWarm);
+        return;
+    }
+
+    UE_LOG(GameServerLog, Log, TEXT("Prewarming %d start-up assets"), AssetsToLoad.Num());
+    StartupPrewarmHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        AssetsToLoad,
+        FStreamableDelegate::CreateWeakLambda(this, [this]()
+        {
+            MarkStartupSignal(EGameLiftStartupSignal::AssetsWarm);
+        }));
+    if (!StartupPrewarmHandle.IsValid())
+    {
+        // Nothing to wait for (already loaded, or every path failed to resolve)
+        MarkStartupSignal(EGameLiftStartupSignal::AssetsWarm);
+    }
+}
+
+void AShooterGameMode::MarkStartupSignal(EGameLiftStartupSignal Signal)
+{
+    if (EnumHasAnyFlags(StartupSignals, Signal))
+    {
+        return;
+    }
+    StartupSignals |= Signal;
+
+    switch (Signal)
+    {
+    case EGameLiftStartupSignal::SdkConnected:
+        MarkStartupMilestone(TEXT("SdkConnected"));
+        break;
+    case EGameLiftStartupSignal::WorldReady:
+        MarkStartupMilestone(TEXT("WorldReady"));
+        break;
+    case EGameLiftStartupSignal::LogsReady:
+        MarkStartupMilestone(TEXT("LogsReady"));
+        break;
+    case EGameLiftStartupSignal::AssetsWarm:
+        MarkStartupMilestone(TEXT("AssetsWarm"));
+        break;
+    default:
+        break;
+    }
+
+    if (EnumHasAllFlags(StartupSignals, EGameLiftStartupSignal::All) && !bProcessReadyRequested)
+    {
+        bProcessReadyRequested = true;
+        CallProcessReady();
+    }
+}
+
+void AShooterGameMode::CallProcessReady()
+{
+    // Check if GameLift module is still valid
+    if (!GameLiftModule)
+    {
+        UE_LOG(GameServerLog, Error, TEXT("❌ GameLift module is null, cannot call ProcessReady"));
+        TransitionToState(EGameLiftServerState::Error);
+        return;
+    }
+
+    // Fill in the parameters SetupGameLiftCallbacks created, keeping the callbacks bound there
+    check(ProcessParameters.IsValid());
+
+    // Set port
+    ProcessParameters->port = ServerConfig.ServerPort;
+    UE_LOG(GameServerLog, Log, TEXT("🔌 Set port: %d"), ServerConfig.ServerPort);
+
+    // Setup log files
+    TArray<FString> LogFiles;
+    LogFiles.Add(ServerConfig.LogDirectory + TEXT("server.log"));
+    LogFiles.Append(ServerConfig.AdditionalLogFiles);
+    ProcessParameters->logParameters = LogFiles;
+    UE_LOG(GameServerLog, Log, TEXT("📝 Configured log files: %d files"), LogFiles.Num());
+
+    // Call ProcessReady
+    UE_LOG(GameServerLog, Log, TEXT("📞 Calling ProcessReady..."));
+    MarkStartupMilestone(TEXT("ProcessReadySent"));
+
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    const double StartSeconds = FPlatformTime::Seconds();
+    GameLiftModule->ProcessReadyAsync(*ProcessParameters, [WeakThis, StartSeconds](FGameLiftGenericOutcome ProcessReadyOutcome)
+    {
+        AShooterGameMode* GameMode = WeakThis.Get();
+        if (!GameMode)
+        {
+            return;
+        }
+        GameMode->RecordSdkLatency(GameMode->MetricHandles.SdkProcessReadyMs, StartSeconds);
+
+        UE_LOG(GameServerLog, Log, TEXT("📞 ProcessReady call completed"));
+        if (ProcessReadyOutcome.IsSuccess())
+        {
+            UE_LOG(GameServerLog, Log, TEXT("✅ ProcessReady successful. Server is ready to host game sessions."));
+            const bool bRecycled = GameMode->ServerState == EGameLiftServerState::Recycling;
+            GameMode->bIsGameLiftInitialized = true;
+            GameMode->TransitionToState(EGameLiftServerState::Ready);
+
+            if (bRecycled)
+            {
+                // Prewarmed content is still resident; only the reset itself is measured
+                const double RecycleSeconds = FPlatformTime::Seconds() - GameMode->RecycleStartedSeconds;
+                const FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
+                const float UsedMemoryMB = (float)(MemStats.UsedPhysical / (1024.0 * 1024.0));
+                GameMode->ServerStats.TotalProcessRecycles++;
+                GameMode->ServerStats.LastRecycleSeconds = (float)RecycleSeconds;
+                UE_LOG(GameServerLog, Log, TEXT("♻️ Process recycled in %.3f s (recycle %d, %.1f MB in use)"),
+                    RecycleSeconds, GameMode->ServerStats.TotalProcessRecycles, UsedMemoryMB);
+                GameMode->RecordHealthMetric(GameMode->MetricHandles.RecycleMs, (float)(RecycleSeconds * 1000.0));
+                GameMode->RecordHealthMetric(GameMode->MetricHandles.RecycleUsedMemoryMB, UsedMemoryMB);
+                return;
+            }
+
+            // The process is ACTIVE on the fleet from here on
+            const double LaunchToActiveSeconds = GameMode->MarkStartupMilestone(TEXT("ProcessActive"));
+            UE_LOG(GameServerLog, Log, TEXT("Process launch to ACTIVE: %.3f s"), LaunchToActiveSeconds);
+            GameMode->RecordHealthMetric(GameMode->MetricHandles.LaunchToActiveMs, (float)(LaunchToActiveSeconds * 1000.0));
+
+            // Load match content while the fleet decides where to place the first session
+            GameMode->StartWorldPrewarm();
+        }
+        else
+        {
+            FGameLiftError Error = ProcessReadyOutcome.GetError();
+            GameMode->LastErrorMessage = Error.m_errorMessage;
+            UE_LOG(GameServerLog, Error, TEXT("❌ ProcessReady failed: %s"), *GameMode->LastErrorMessage);
+            GameMode->TransitionToState(EGameLiftServerState::Error);
+        }
+    });
+}
+
 void AShooterGameMode::SetupGameLiftCallbacks()
 {
     UE_LOG(GameServerLog, Log, TEXT("🔗 Setting up GameLift callbacks"));
@@ -335,7 +573,10 @@ void AShooterGameMode::SetupGameLiftCallbacks()
     ProcessParameters->OnStartGameSession.BindLambda([this](Aws::GameLift::Server::Model::GameSession InGameSession)
         {
             UE_LOG(GameServerLog, Log, TEXT("🎮 OnStartGameSession callback triggered"));
-            HandleGameSessionStart(InGameSession);
+            GameThreadCommands.Enqueue(TEXT("StartGameSession"), EGameLiftCommandKind::Lifecycle, [this, Session = MoveTemp(InGameSession)]()
+                {
+                    HandleGameSessionStart(Session);
+                });
         });
 
     // OnProcessTerminate callback
@@ -343,11 +584,15 @@ void AShooterGameMode::SetupGameLiftCallbacks()
     ProcessParameters->OnTerminate.BindLambda([this]()
         {
             UE_LOG(GameServerLog, Log, TEXT("🛑 OnTerminate callback triggered"));
-            HandleProcessTerminate();
+            GameThreadCommands.Enqueue(TEXT("ProcessTerminate"), EGameLiftCommandKind::Lifecycle, [this]()
+                {
+                    HandleProcessTerminate();
+                });
         });
 
     // OnHealthCheck callback
     UE_LOG(GameServerLog, Log, TEXT("💓 Binding OnHealthCheck callback"));
+    // Answered on the SDK thread from the published health snapshot; see HandleHealthCheck
     ProcessParameters->OnHealthCheck.BindLambda([this]()
         {
             UE_LOG(GameServerLog, Verbose, TEXT("💓 OnHealthCheck callback triggered"));
@@ -359,7 +604,10 @@ void AShooterGameMode::SetupGameLiftCallbacks()
     ProcessParameters->OnUpdateGameSession.BindLambda([this](Aws::GameLift::Server::Model::UpdateGameSession UpdateGameSession)
         {
             UE_LOG(GameServerLog, Log, TEXT("🔄 OnUpdateGameSession callback triggered"));
-            HandleGameSessionUpdate(UpdateGameSession);
+            GameThreadCommands.Enqueue(TEXT("UpdateGameSession"), EGameLiftCommandKind::Lifecycle, [this, Update = MoveTemp(UpdateGameSession)]()
+                {
+                    HandleGameSessionUpdate(Update);
+                });
         });
 
     UE_LOG(GameServerLog, Log, TEXT("✅ All GameLift callbacks configured successfully"));
@@ -388,6 +636,9 @@ void AShooterGameMode::ParseCommandLineArguments()
     // Parse other configuration options
     FParse::Value(FCommandLine::Get(), TEXT("maxplayers="), MaxPlayers);
     FParse::Bool(FCommandLine::Get(), TEXT("detailedlogging="), ServerConfig.bEnableDetailedLogging);
+    FParse::Value(FCommandLine::Get(), TEXT("statsdhost="), ServerConfig.StatsDHost);
+    FParse::Value(FCommandLine::Get(), TEXT("statsdport="), ServerConfig.StatsDPort);
+    FParse::Bool(FCommandLine::Get(), TEXT("emfmetrics="), ServerConfig.bWriteEmfMetrics);
 
     UE_LOG(GameServerLog, Log, TEXT("Server configuration: Port=%d, MaxPlayers=%d"),
         ServerConfig.ServerPort, MaxPlayers);
@@ -440,6 +691,12 @@ void AShooterGameMode::ParseGameLiftAnywhereParameters(FServerParameters& OutPar
     {
         UE_LOG(GameServerLog, Log, TEXT("✅ Process ID from command line: %s"), *ProcessId);
     }
+    if (NumProcessReregistrations > 0)
+    {
+        // The ID the process ended under is not reused for the next registration
+        ProcessId += FString::Printf(TEXT("_r%d"), NumProcessReregistrations);
+        UE_LOG(GameServerLog, Log, TEXT("♻️ Re-registering as Process ID: %s"), *ProcessId);
+    }
     OutParams.m_processId = TCHAR_TO_UTF8(*ProcessId);
 
     // Parse Host ID
@@ -550,19 +807,18 @@ bool AShooterGameMode::ValidateServerConfiguration()
 #endif
 
 // State Management
-void AShooterGameMode::TransitionToState(EGameLiftServerState NewState)
+bool AShooterGameMode::TransitionToState(EGameLiftServerState NewState)
 {
-    FScopeLock Lock(&StateLock);
-
     if (!CanTransitionToState(NewState))
     {
         UE_LOG(GameServerLog, Warning, TEXT("Invalid state transition from %d to %d"),
             (int32)ServerState, (int32)NewState);
-        return;
+        return false;
     }
 
     EGameLiftServerState OldState = ServerState;
     ServerState = NewState;
+    PublishedServerState.store(NewState, std::memory_order_relaxed);
 
     if (ServerConfig.bEnableDetailedLogging)
     {
@@ -571,6 +827,7 @@ void AShooterGameMode::TransitionToState(EGameLiftServerState NewState)
     }
 
     HandleStateTransition(OldState, NewState);
+    return true;
 }
 
 bool AShooterGameMode::CanTransitionToState(EGameLiftServerState NewState) const
@@ -601,9 +858,16 @@ bool AShooterGameMode::CanTransitionToState(EGameLiftServerState NewState) const
 
     case EGameLiftServerState::InSession:
         return NewState == EGameLiftServerState::Ready ||
+            NewState == EGameLiftServerState::Recycling ||
             NewState == EGameLiftServerState::Terminating ||
             NewState == EGameLiftServerState::Error;
 
+    case EGameLiftServerState::Recycling:
+        return NewState == EGameLiftServerState::Ready ||
+            NewState == EGameLiftServerState::Terminating ||
+            NewState == EGameLiftServerState::Error ||
+            NewState == EGameLiftServerState::Shutdown;
+
     case EGameLiftServerState::Terminating:
         return NewState == EGameLiftServerState::Shutdown;
 
@@ -626,6 +890,18 @@ void AShooterGameMode::HandleStateTransition(EGameLiftServerState OldState, EGam
     {
     case EGameLiftServerState::Ready:
         UE_LOG(GameServerLog, Log, TEXT("Server is ready to host game sessions"));
+#if WITH_GAMELIFT
+        if (DeferredGameSessionStart.IsSet())
+        {
+            // Queued rather than run here, so the start never re-enters this transition
+            GameThreadCommands.Enqueue(TEXT("StartGameSession"), EGameLiftCommandKind::Lifecycle,
+                [this, Session = DeferredGameSessionStart.GetValue()]()
+                {
+                    HandleGameSessionStart(Session);
+                });
+            DeferredGameSessionStart.Reset();
+        }
+#endif
         break;
 
     case EGameLiftServerState::InSession:
@@ -653,16 +929,37 @@ void AShooterGameMode::HandleStateTransition(EGameLiftServerState OldState, EGam
 #if WITH_GAMELIFT
 void AShooterGameMode::HandleGameSessionStart(const Aws::GameLift::Server::Model::GameSession& InGameSession)
 {
-    FScopeLock Lock(&SessionLock);
-
     UE_LOG(GameServerLog, Log, TEXT("Received game session activation request"));
 
-    TransitionToState(EGameLiftServerState::ActivatingSession);
+    // GameLift can place a session as soon as ProcessReady reaches it, before the completion that
+    // moves this process to Ready has run; hold the start until then
+    if (ServerState == EGameLiftServerState::Initializing || ServerState == EGameLiftServerState::Recycling)
+    {
+        UE_LOG(GameServerLog, Log, TEXT("ProcessReady still in flight, deferring game session start"));
+        DeferredGameSessionStart = InGameSession;
+        return;
+    }
+
+    SessionStartRequestedSeconds = FPlatformTime::Seconds();
+    if (!TransitionToState(EGameLiftServerState::ActivatingSession))
+    {
+        UE_LOG(GameServerLog, Error, TEXT("Cannot start game session %s in state %d"),
+            *FString(InGameSession.GetGameSessionId()), (int32)ServerState);
+        return;
+    }
 
     // Extract session information
     CurrentGameSessionId = FString(InGameSession.GetGameSessionId());
     MaxPlayers = InGameSession.GetMaximumPlayerSessionCount();
 
+    // Parsed by the SDK module before this callback fired
+    MatchmakerData = GameLiftModule->GetMatchmakerData();
+    if (MatchmakerData.IsValid())
+    {
+        UE_LOG(GameServerLog, Log, TEXT("Matchmaker data: match %s, %d teams, %d players"),
+            *MatchmakerData->m_matchId, MatchmakerData->m_teams.Num(), MatchmakerData->GetPlayerCount());
+    }
+
     // Parse game properties
     int32 PropertyCount = 0;
     const Aws::GameLift::Server::Model::GameProperty* Properties = InGameSession.GetGameProperties(PropertyCount);
@@ -686,6 +983,15 @@ void AShooterGameMode::HandleGameSessionStart(const Aws::GameLift::Server::Model
         return;
     }
 
+    // Content for the session's map, if it differs from the map this process already prewarmed
+    if (const FString* SessionMap = GameSessionProperties.Find(ServerConfig.MapGamePropertyKey))
+    {
+        if (*SessionMap != UWorld::RemovePIEPrefix(GetWorld()->GetMapName()))
+        {
+            RequestMapPrewarm(*SessionMap);
+        }
+    }
+
     // Prepare the game world
     PrepareGameWorld(GameSessionProperties);
 
@@ -697,36 +1003,116 @@ void AShooterGameMode::HandleGameSessionStart(const Aws::GameLift::Server::Model
         return;
     }
 
-    // Activate the game session
-    FGameLiftGenericOutcome ActivateOutcome = GameLiftModule->ActivateGameSession();
+    // Activation waits for match content so the first players do not hitch on loads
+    if (!WorldPrewarm.IsComplete())
+    {
+        UE_LOG(GameServerLog, Log, TEXT("Waiting up to %.1f s for world prewarm before activating game session"),
+            ServerConfig.PrewarmTimeoutSeconds);
+    }
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    WorldPrewarm.WhenComplete(ServerConfig.PrewarmTimeoutSeconds, [WeakThis]()
+    {
+        if (AShooterGameMode* GameMode = WeakThis.Get())
+        {
+            GameMode->ActivateGameSession();
+        }
+    });
+}
 
-    if (ActivateOutcome.IsSuccess())
+void AShooterGameMode::ActivateGameSession()
+{
+    // The session may have been terminated while prewarm was running
+    if (ServerState != EGameLiftServerState::ActivatingSession)
     {
-        bIsGameSessionActive = true;
-        CurrentPlayerCount = 0;
-        TransitionToState(EGameLiftServerState::InSession);
+        return;
+    }
+
+    // Activate the game session. Issued asynchronously so the round trip does not stall the frame
+    // that drains this command; the completion runs on the game thread.
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    const double StartSeconds = FPlatformTime::Seconds();
+    GameLiftModule->ActivateGameSessionAsync([WeakThis, StartSeconds](FGameLiftGenericOutcome ActivateOutcome)
+    {
+        AShooterGameMode* GameMode = WeakThis.Get();
+        if (!GameMode)
+        {
+            return;
+        }
+        GameMode->RecordSdkLatency(GameMode->MetricHandles.SdkActivateGameSessionMs, StartSeconds);
+        if (GameMode->ServerState != EGameLiftServerState::ActivatingSession)
+        {
+            return;
+        }
+
+        if (ActivateOutcome.IsSuccess())
+        {
+            GameMode->bIsGameSessionActive = true;
+            GameMode->CurrentPlayerCount = 0;
+            GameMode->FrameTimes.ResetMatch();
+            GameMode->TransitionToState(EGameLiftServerState::InSession);
 
-        UE_LOG(GameServerLog, Log, TEXT("Game session activated successfully: %s"), *CurrentGameSessionId);
+            const double StartToActiveSeconds = FPlatformTime::Seconds() - GameMode->SessionStartRequestedSeconds;
+            UE_LOG(GameServerLog, Log, TEXT("Game session activated successfully: %s (%.3f s after start request)"),
+                *GameMode->CurrentGameSessionId, StartToActiveSeconds);
+            GameMode->RecordHealthMetric(GameMode->MetricHandles.SessionStartToActiveMs, (float)(StartToActiveSeconds * 1000.0));
 
-        // Notify blueprints
-        OnGameSessionActivated.Broadcast(CurrentGameSessionId);
+            // Notify blueprints
+            GameMode->OnGameSessionActivated.Broadcast(GameMode->CurrentGameSessionId);
 
-        // Call virtual function for game-specific logic
-        OnGameSessionStarted(CurrentGameSessionId);
+            // Call virtual function for game-specific logic
+            GameMode->OnGameSessionStarted(GameMode->CurrentGameSessionId);
+
+            if (GameMode->ServerStats.TotalSessionsHosted == 1)
+            {
+                GameMode->MarkStartupMilestone(TEXT("FirstGameSessionActive"));
+            }
+        }
+        else
+        {
+            FGameLiftError Error = ActivateOutcome.GetError();
+            UE_LOG(GameServerLog, Error, TEXT("Failed to activate game session: %s"), *Error.m_errorMessage);
+            GameMode->TransitionToState(EGameLiftServerState::Ready);
+        }
+    });
+}
+
+void AShooterGameMode::StartWorldPrewarm()
+{
+    TArray<FSoftObjectPath> Assets;
+    AppendPrewarmSet(ServerConfig.MatchPrewarm, Assets);
+    if (DefaultPawnClass)
+    {
+        Assets.Add(FSoftObjectPath(DefaultPawnClass.Get()));
     }
-    else
+    WorldPrewarm.Request(TEXT("match"), Assets);
+
+    RequestMapPrewarm(UWorld::RemovePIEPrefix(GetWorld()->GetMapName()));
+}
+
+void AShooterGameMode::RequestMapPrewarm(const FString& MapName)
+{
+    const FGameLiftPrewarmSet* MapSet = ServerConfig.MapPrewarm.Find(MapName);
+    if (!MapSet)
     {
-        FGameLiftError Error = ActivateOutcome.GetError();
-        UE_LOG(GameServerLog, Error, TEXT("Failed to activate game session: %s"), *Error.m_errorMessage);
-        TransitionToState(EGameLiftServerState::Ready);
+        return;
     }
+
+    TArray<FSoftObjectPath> Assets;
+    AppendPrewarmSet(*MapSet, Assets);
+    WorldPrewarm.Request(*MapName, Assets);
 }
 
 void AShooterGameMode::HandleProcessTerminate()
 {
     UE_LOG(GameServerLog, Warning, TEXT("Received termination request from GameLift"));
 
+    if (bIsTerminating)
+    {
+        // ProcessEnding is already in flight
+        return;
+    }
     bIsTerminating = true;
+    DeferredGameSessionStart.Reset();
     TransitionToState(EGameLiftServerState::Terminating);
 
     // Save logs
@@ -738,66 +1124,145 @@ void AShooterGameMode::HandleProcessTerminate()
         CleanupGameSession();
     }
 
-    // Notify GameLift we're shutting down
-    FGameLiftGenericOutcome ProcessEndingOutcome = GameLiftModule->ProcessEnding();
-    if (!ProcessEndingOutcome.IsSuccess())
+    // Notify GameLift we're shutting down. The SDK is destroyed only once the notification has
+    // completed, so Destroy never tears down the connection under the in-flight call. The module
+    // outlives this game mode, so the SDK is destroyed even if the world goes away first.
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    FGameLiftServerSDKModule* SdkModule = GameLiftModule;
+    GameLiftModule->ProcessEndingAsync([WeakThis, SdkModule](FGameLiftGenericOutcome ProcessEndingOutcome)
+    {
+        if (!ProcessEndingOutcome.IsSuccess())
+        {
+            FGameLiftError Error = ProcessEndingOutcome.GetError();
+            UE_LOG(GameServerLog, Error, TEXT("ProcessEnding failed: %s"), *Error.m_errorMessage);
+        }
+
+        // Destroy SDK
+        FGameLiftGenericOutcome DestroyOutcome = SdkModule->Destroy();
+        if (!DestroyOutcome.IsSuccess())
+        {
+            FGameLiftError Error = DestroyOutcome.GetError();
+            UE_LOG(GameServerLog, Error, TEXT("SDK Destroy failed: %s"), *Error.m_errorMessage);
+        }
+
+        if (AShooterGameMode* GameMode = WeakThis.Get())
+        {
+            GameMode->bIsGameLiftInitialized = false;
+            GameMode->TransitionToState(EGameLiftServerState::Shutdown);
+        }
+    });
+}
+#endif
+
+bool AShooterGameMode::HandleHealthCheck()
+{
+    // Called on an SDK thread: read only the snapshot the game thread published, never the world
+    FGameLiftHealthSnapshot Snapshot;
+    if (!HealthSnapshot.Read(Snapshot))
     {
-        FGameLiftError Error = ProcessEndingOutcome.GetError();
-        UE_LOG(GameServerLog, Error, TEXT("ProcessEnding failed: %s"), *Error.m_errorMessage);
+        UE_LOG(GameServerLog, Warning, TEXT("Health check failed: no health snapshot published yet"));
+        return false;
     }
 
-    // Destroy SDK
-    FGameLiftGenericOutcome DestroyOutcome = GameLiftModule->Destroy();
-    if (!DestroyOutcome.IsSuccess())
+    FString HealthDetails;
+    const bool bIsHealthy = EvaluateHealth(Snapshot, HealthDetails);
+    Metrics.AddCounter(bIsHealthy ? MetricHandles.HealthChecksPassed : MetricHandles.HealthChecksFailed);
+    if (!bIsHealthy)
+    {
+        UE_LOG(GameServerLog, Warning, TEXT("Health check failed: %s(frame time p50 %.1f ms, p99 %.1f ms, max %.1f ms)"),
+            *HealthDetails, Snapshot.FrameTimeP50Ms, Snapshot.FrameTimeP99Ms, Snapshot.FrameTimeMaxMs);
+    }
+    else
     {
-        FGameLiftError Error = DestroyOutcome.GetError();
-        UE_LOG(GameServerLog, Error, TEXT("SDK Destroy failed: %s"), *Error.m_errorMessage);
+        UE_LOG(GameServerLog, Verbose, TEXT("Health check passed"));
     }
 
-    TransitionToState(EGameLiftServerState::Shutdown);
+    return bIsHealthy;
 }
-#endif
 
-bool AShooterGameMode::HandleHealthCheck()
+bool AShooterGameMode::EvaluateHealth(const FGameLiftHealthSnapshot& Snapshot, FString& OutDetails) const
 {
     bool bIsHealthy = true;
-    FString HealthDetails;
 
 #if WITH_GAMELIFT
-    FScopeLock Lock(&StateLock);
-
     // Don't report healthy during error or shutdown states
-    if (ServerState == EGameLiftServerState::Error ||
-        ServerState == EGameLiftServerState::Shutdown ||
-        ServerState == EGameLiftServerState::Terminating)
+    const EGameLiftServerState CurrentState = PublishedServerState.load(std::memory_order_relaxed);
+    if (CurrentState == EGameLiftServerState::Error ||
+        CurrentState == EGameLiftServerState::Shutdown ||
+        CurrentState == EGameLiftServerState::Terminating)
     {
-        bIsHealthy = false;
-        HealthDetails = TEXT("Server in unhealthy state");
+        OutDetails = TEXT("Server in unhealthy state");
+        return false;
     }
-    else
 #endif
+
+    // Check memory health
+    if (!CheckMemoryHealth(Snapshot))
     {
-        // Check memory health
-        if (!CheckMemoryHealth())
-        {
-            bIsHealthy = false;
-            HealthDetails += TEXT("High memory usage; ");
-        }
+        bIsHealthy = false;
+        OutDetails += TEXT("High memory usage; ");
+    }
+
+    // Check game loop health
+    if (!CheckGameLoopHealth(Snapshot))
+    {
+        bIsHealthy = false;
+        OutDetails += TEXT("Game loop stalled; ");
+    }
+
+    // Custom health checks ran on the game thread when the snapshot was taken
+    if (!Snapshot.bCustomHealthCheckPassed)
+    {
+        bIsHealthy = false;
+        OutDetails += TEXT("Custom health check failed; ");
+    }
+
+    return bIsHealthy;
+}
+
+#if WITH_GAMELIFT
+void AShooterGameMode::HandleGameSessionUpdate(const Aws::GameLift::Server::Model::UpdateGameSession& UpdateGameSession)
+{
+    UE_LOG(GameServerLog, Log, TEXT("Received game session update"));
 
-        // Check game loop health
-        if (!CheckGameLoopHealth())
+    // Handle backfill ticket updates
+    if (UpdateGameSession.GetUpdateReason() == Aws::GameLift::Server::Model::UpdateReason::MATCHMAKING_DATA_UPDATED)
+    {
+        // The SDK module has already parsed the new matchmaker data; just pick up the new view
+        MatchmakerData = GameLiftModule->GetMatchmakerData();
+
+        if (ServerConfig.bEnableDetailedLogging && MatchmakerData.IsValid())
         {
-            bIsHealthy = false;
-            HealthDetails += TEXT("Game loop stalled; ");
+            UE_LOG(GameServerLog, Log, TEXT("Matchmaking data updated: %d teams, %d players"),
+                MatchmakerData->m_teams.Num(), MatchmakerData->GetPlayerCount());
         }
+    }
 
-        // Perform custom health checks
-        if (!PerformCustomHealthCheck())
+}
+#endif
+
+FString AShooterGameMode::GetMatchmakerTeamForPlayer(const FString& PlayerId) const
+{
+#if WITH_GAMELIFT
+    if (MatchmakerData.IsValid())
+    {
+        if (const FPlayer* Player = MatchmakerData->FindPlayer(PlayerId))
         {
-            bIsHealthy = false;
-            HealthDetails += TEXT("Custom health check failed; ");
+            return Player->m_team;
         }
     }
+#endif
+    return FString();
+}
+
+// Health Monitoring
+void AShooterGameMode::PerformHealthCheck()
+{
+    FGameLiftHealthSnapshot Snapshot;
+    HealthSnapshot.Read(Snapshot);
+
+    FString HealthDetails;
+    const bool bIsHealthy = EvaluateHealth(Snapshot, HealthDetails);
 
 #if WITH_GAMELIFT
     // Update statistics
@@ -829,82 +1294,84 @@ bool AShooterGameMode::HandleHealthCheck()
         UE_LOG(GameServerLog, Verbose, TEXT("Health check passed"));
     }
 #endif
-
-    return bIsHealthy;
 }
 
-#if WITH_GAMELIFT
-void AShooterGameMode::HandleGameSessionUpdate(const Aws::GameLift::Server::Model::UpdateGameSession& UpdateGameSession)
+void AShooterGameMode::UpdateServerStatistics()
 {
-    UE_LOG(GameServerLog, Log, TEXT("Received game session update"));
-
-    // Handle backfill ticket updates
-    FString UpdateReason = FString::Printf(TEXT("%d"), (int32)UpdateGameSession.GetUpdateReason());
-
-    if (UpdateReason == TEXT("MATCHMAKING_DATA_UPDATED"))
+    // Frame times over the recent window
+    const FGameLiftFrameTimeSummary FrameSummary = FrameTimes.ConsumeWindow();
+    if (FrameSummary.FrameCount > 0)
     {
-        // Handle matchmaking updates
-        FString MatchmakingData = FString(UpdateGameSession.GetGameSession().GetMatchmakerData());
-        if (ServerConfig.bEnableDetailedLogging)
-        {
-            UE_LOG(GameServerLog, Log, TEXT("Matchmaking data updated"));
-        }
+        ServerStats.AverageTickRate = 1000.0f / FMath::Max(FrameSummary.MeanMs, 1.0f);
+        ServerStats.FrameTimeP50Ms = FrameSummary.P50Ms;
+        ServerStats.FrameTimeP95Ms = FrameSummary.P95Ms;
+        ServerStats.FrameTimeP99Ms = FrameSummary.P99Ms;
+        ServerStats.FrameTimeMaxMs = FrameSummary.MaxMs;
+        ServerStats.TotalHitches += FrameSummary.HitchCounts[0];
+        Metrics.AddCounter(MetricHandles.Hitches, FrameSummary.HitchCounts[0]);
     }
 
-}
+    PublishHealthSnapshot(FrameSummary);
+
+#if WITH_GAMELIFT
+    RecordHealthMetric(MetricHandles.FrameTimeP50Ms, FrameSummary.P50Ms);
+    RecordHealthMetric(MetricHandles.FrameTimeP95Ms, FrameSummary.P95Ms);
+    RecordHealthMetric(MetricHandles.FrameTimeP99Ms, FrameSummary.P99Ms);
+    RecordHealthMetric(MetricHandles.FrameTimeMaxMs, FrameSummary.MaxMs);
+    RecordHealthMetric(MetricHandles.FrameWorkMs, FrameSummary.WorkMs);
+    RecordHealthMetric(MetricHandles.FrameIdleMs, FrameSummary.IdleMs);
+    RecordHealthMetric(MetricHandles.FrameSdkCommandsMs, FrameSummary.SdkCommandsMs);
 #endif
 
-// Health Monitoring
-void AShooterGameMode::PerformHealthCheck()
-{
-    HandleHealthCheck();
+#if WITH_GAMELIFT
+    // Game thread command queue pressure over the last interval
+    const FGameLiftCommandQueue::FStats CommandStats = GameThreadCommands.ConsumeStats();
+    RecordHealthMetric(MetricHandles.CommandQueueMaxDepth, CommandStats.MaxDepth);
+    RecordHealthMetric(MetricHandles.CommandQueueMaxLatencyMs, (float)(CommandStats.MaxLatencySeconds * 1000.0));
+    if (CommandStats.Executed > 0)
+    {
+        RecordHealthMetric(MetricHandles.CommandQueueAvgLatencyMs, (float)(CommandStats.TotalLatencySeconds * 1000.0 / CommandStats.Executed));
+    }
+    Metrics.AddCounter(MetricHandles.SdkCallbacksDropped, CommandStats.Rejected);
+    if (CommandStats.Rejected > 0)
+    {
+        UE_LOG(GameServerLog, Error, TEXT("%d SDK callbacks were dropped because the game thread command queue was full"), CommandStats.Rejected);
+    }
+#endif
 }
 
-void AShooterGameMode::UpdateServerStatistics()
+void AShooterGameMode::PublishHealthSnapshot(const FGameLiftFrameTimeSummary& FrameSummary)
 {
-    // Update tick rate
-    if (TickCounter > 0)
-    {
-        float AverageTickTime = TickTimeAccumulator / TickCounter;
-        float TickRate = 1.0f / FMath::Max(AverageTickTime, 0.001f);
+    FGameLiftHealthSnapshot Snapshot;
+    Snapshot.PublishedAtSeconds = FPlatformTime::Seconds();
+    Snapshot.AverageTickRate = ServerStats.AverageTickRate;
+    Snapshot.FrameTimeP50Ms = FrameSummary.P50Ms;
+    Snapshot.FrameTimeP99Ms = FrameSummary.P99Ms;
+    Snapshot.FrameTimeMaxMs = FrameSummary.MaxMs;
+    Snapshot.HitchCount = FrameSummary.HitchCounts[0];
 
-        RecentTickRates.Add(TickRate);
-        if (RecentTickRates.Num() > MAX_TICK_RATE_SAMPLES)
-        {
-            RecentTickRates.RemoveAt(0);
-        }
+    const FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
+    Snapshot.MemoryUsagePercent = (float)(MemStats.UsedPhysical) / (float)(MemStats.TotalPhysical) * 100.0f;
+    ServerStats.CurrentMemoryUsagePercent = Snapshot.MemoryUsagePercent;
 
-#if WITH_GAMELIFT
-        // Calculate average tick rate
-        float TotalTickRate = 0.0f;
-        for (float Rate : RecentTickRates)
-        {
-            TotalTickRate += Rate;
-        }
-        ServerStats.AverageTickRate = TotalTickRate / RecentTickRates.Num();
-#endif
+    Snapshot.PlayerCount = CurrentPlayerCount;
+    Snapshot.bIsGameSessionActive = bIsGameSessionActive;
+    Snapshot.bCustomHealthCheckPassed = PerformCustomHealthCheck();
 
-        // Reset counters
-        TickTimeAccumulator = 0.0f;
-        TickCounter = 0;
-    }
+    HealthSnapshot.Publish(Snapshot);
 
 #if WITH_GAMELIFT
-    // Update memory usage
-    const FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
-    ServerStats.CurrentMemoryUsagePercent = (float)(MemStats.UsedPhysical) / (float)(MemStats.TotalPhysical) * 100.0f;
-
     // Record metrics
-    RecordHealthMetric(TEXT("TickRate"), ServerStats.AverageTickRate);
-    RecordHealthMetric(TEXT("MemoryUsage"), ServerStats.CurrentMemoryUsagePercent);
-    RecordHealthMetric(TEXT("PlayerCount"), CurrentPlayerCount);
+    RecordHealthMetric(MetricHandles.TickRate, Snapshot.AverageTickRate);
+    RecordHealthMetric(MetricHandles.MemoryUsage, Snapshot.MemoryUsagePercent);
+    RecordHealthMetric(MetricHandles.PlayerCount, Snapshot.PlayerCount);
+    RecordHealthMetric(MetricHandles.HitchCount, Snapshot.HitchCount);
 #endif
 }
 
-bool AShooterGameMode::CheckMemoryHealth()
+bool AShooterGameMode::CheckMemoryHealth(const FGameLiftHealthSnapshot& Snapshot) const
 {
-    const FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
-    float MemoryUsagePercent = (float)(MemStats.UsedPhysical) / (float)(MemStats.TotalPhysical) * 100.0f;
+    const float MemoryUsagePercent = Snapshot.MemoryUsagePercent;
 
 #if WITH_GAMELIFT
     if (MemoryUsagePercent > ServerConfig.MaxMemoryUsagePercent)
@@ -927,10 +1394,10 @@ bool AShooterGameMode::CheckMemoryHealth()
     return true;
 }
 
-bool AShooterGameMode::CheckGameLoopHealth()
+bool AShooterGameMode::CheckGameLoopHealth(const FGameLiftHealthSnapshot& Snapshot) const
 {
-    float CurrentTime = GetWorld()->GetTimeSeconds();
-    float TimeSinceLastTick = CurrentTime - LastTickTime;
+    // The game thread publishes every TICK_RATE_UPDATE_INTERVAL; an old snapshot means it stopped ticking
+    const double TimeSinceLastTick = FPlatformTime::Seconds() - Snapshot.PublishedAtSeconds - TICK_RATE_UPDATE_INTERVAL;
 
 #if WITH_GAMELIFT
     if (TimeSinceLastTick > ServerConfig.MaxGameLoopStallSeconds)
@@ -953,20 +1420,63 @@ bool AShooterGameMode::CheckGameLoopHealth()
     return true;
 }
 
-void AShooterGameMode::RecordHealthMetric(const FString& MetricName, float Value)
+double AShooterGameMode::MarkStartupMilestone(const TCHAR* Milestone) const
+{
+    // GStartTime is taken as the engine starts, as close to process launch as the game can see
+    const double SinceLaunchSeconds = FPlatformTime::Seconds() - GStartTime;
+    TRACE_BOOKMARK(TEXT("GameLift startup: %s"), Milestone);
+    UE_LOG(GameServerLog, Log, TEXT("⏱️ Startup timeline +%.3f s: %s"), SinceLaunchSeconds, Milestone);
+    return SinceLaunchSeconds;
+}
+
+void AShooterGameMode::RecordHealthMetric(FGameLiftMetricHandle Metric, float Value)
 {
+    Metrics.SetGauge(Metric, Value);
+
 #if WITH_GAMELIFT
-    // This is where you would send metrics to CloudWatch or your monitoring system
+    // Exported by the metrics registry; the log line is for local debugging
     if (ServerConfig.bEnableDetailedLogging)
     {
-        UE_LOG(GameServerLog, VeryVerbose, TEXT("Metric: %s = %.2f"), *MetricName, Value);
+        UE_LOG(GameServerLog, VeryVerbose, TEXT("Metric: %s = %.2f"), *Metrics.GetName(Metric).ToString(), Value);
     }
 #else
     // Simple logging when GameLift is not available
-    UE_LOG(GameServerLog, VeryVerbose, TEXT("Metric: %s = %.2f"), *MetricName, Value);
+    UE_LOG(GameServerLog, VeryVerbose, TEXT("Metric: %s = %.2f"), *Metrics.GetName(Metric).ToString(), Value);
 #endif
 }
 
+void AShooterGameMode::RecordSdkLatency(FGameLiftMetricHandle Metric, double StartSeconds)
+{
+    Metrics.RecordHistogram(Metric, (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
+
+void AShooterGameMode::ConfigureMetricsExporters()
+{
+    if (!ServerConfig.StatsDHost.IsEmpty())
+    {
+        Metrics.AddExporter(MakeUnique<FGameLiftStatsDExporter>(ServerConfig.StatsDHost, ServerConfig.StatsDPort, ServerConfig.MetricsPrefix));
+    }
+
+    if (ServerConfig.bWriteEmfMetrics)
+    {
+        TMap<FString, FString> Properties;
+        Properties.Add(TEXT("ProcessId"), FString::FromInt(FPlatformProcess::GetCurrentProcessId()));
+        Properties.Add(TEXT("ServerPort"), FString::FromInt(ServerConfig.ServerPort));
+        Metrics.AddExporter(MakeUnique<FGameLiftEmfFileExporter>(ServerConfig.LogDirectory + TEXT("metrics.emf.log"),
+            ServerConfig.EmfNamespace, Properties));
+    }
+
+    if (Metrics.HasExporters())
+    {
+        GetWorldTimerManager().SetTimer(
+            MetricsFlushTimerHandle,
+            FTimerDelegate::CreateWeakLambda(this, [this]() { Metrics.Flush(); }),
+            FMath::Max(ServerConfig.MetricsFlushIntervalSeconds, 1.0f),
+            true
+        );
+    }
+}
+
 // Player Management
 void AShooterGameMode::PreLogin(const FString& Options, const FString& Address,
     const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage)
@@ -981,7 +1491,9 @@ void AShooterGameMode::PreLogin(const FString& Options, const FString& Address,
         return;
     }
 
-    // Extract player session ID from options
+    // Extract player session ID from options. The ID itself is validated with GameLift
+    // asynchronously once the player controller exists (see Login), so PreLogin never
+    // blocks the game thread on a service round trip. Until then the player is held pending.
     FString PlayerSessionId;
     if (!FParse::Value(*Options, TEXT("PlayerSessionId="), PlayerSessionId))
     {
@@ -989,14 +1501,6 @@ void AShooterGameMode::PreLogin(const FString& Options, const FString& Address,
         UE_LOG(GameServerLog, Warning, TEXT("Player connection rejected: %s"), *ErrorMessage);
         return;
     }
-
-    // Validate with GameLift
-    if (!AcceptPlayerSession(PlayerSessionId))
-    {
-        ErrorMessage = TEXT("Invalid PlayerSessionId");
-        UE_LOG(GameServerLog, Warning, TEXT("Player connection rejected: %s"), *ErrorMessage);
-        return;
-    }
 #endif
 }
 
@@ -1008,26 +1512,25 @@ APlayerController* AShooterGameMode::Login(UPlayer* NewPlayer, ENetRole InRemote
 
     if (NewPlayerController)
     {
-        FScopeLock Lock(&PlayerLock);
-
         // Extract player session ID
         FString PlayerSessionId;
         FParse::Value(*Options, TEXT("PlayerSessionId="), PlayerSessionId);
 
         if (!PlayerSessionId.IsEmpty())
         {
-            PlayerSessions.Add(PlayerSessionId, NewPlayerController);
-            CurrentPlayerCount++;
 #if WITH_GAMELIFT
-            ServerStats.TotalPlayersConnected++;
-
-            UE_LOG(GameServerLog, Log, TEXT("Player joined: %s (Total: %d/%d)"),
-                *PlayerSessionId, CurrentPlayerCount, MaxPlayers);
-
-            OnPlayerJoinedSession.Broadcast(PlayerSessionId);
+            // The player joins once GameLift accepts the session, and is kicked if it rejects it
+            PendingPlayerSessions.Add(PlayerSessionId, NewPlayerController);
+            if (!AcceptPlayerSession(PlayerSessionId))
+            {
+                PendingPlayerSessions.Remove(PlayerSessionId);
+                ErrorMessage = TEXT("No active game session");
+                UE_LOG(GameServerLog, Warning, TEXT("Player connection rejected: %s"), *ErrorMessage);
+                NewPlayerController->Destroy();
+                return nullptr;
+            }
 #else
-            UE_LOG(GameServerLog, Log, TEXT("Player joined: %s (Total: %d)"),
-                *PlayerSessionId, CurrentPlayerCount);
+            CompletePlayerJoin(PlayerSessionId, NewPlayerController);
 #endif
         }
     }
@@ -1035,13 +1538,44 @@ APlayerController* AShooterGameMode::Login(UPlayer* NewPlayer, ENetRole InRemote
     return NewPlayerController;
 }
 
+void AShooterGameMode::HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer)
+{
+    for (const auto& Pair : PendingPlayerSessions)
+    {
+        if (Pair.Value.Get() == NewPlayer)
+        {
+            // Started from the AcceptPlayerSession completion instead
+            return;
+        }
+    }
+
+    Super::HandleStartingNewPlayer_Implementation(NewPlayer);
+}
+
+void AShooterGameMode::CompletePlayerJoin(const FString& PlayerSessionId, APlayerController* PlayerController)
+{
+    PlayerSessions.Add(PlayerSessionId, PlayerController);
+    CurrentPlayerCount++;
+    Metrics.AddCounter(MetricHandles.PlayersJoined);
+#if WITH_GAMELIFT
+    ServerStats.TotalPlayersConnected++;
+
+    UE_LOG(GameServerLog, Log, TEXT("Player joined: %s (Total: %d/%d)"),
+        *PlayerSessionId, CurrentPlayerCount, MaxPlayers);
+
+    OnPlayerJoinedSession.Broadcast(PlayerSessionId);
+#else
+    UE_LOG(GameServerLog, Log, TEXT("Player joined: %s (Total: %d)"),
+        *PlayerSessionId, CurrentPlayerCount);
+#endif
+}
+
 void AShooterGameMode::Logout(AController* Exiting)
 {
     if (APlayerController* PC = Cast<APlayerController>(Exiting))
     {
-        FScopeLock Lock(&PlayerLock);
-
-        // Find and remove player session
+        // Find and remove player session. A player still pending never joined; the AcceptPlayerSession
+        // completion releases its session.
         FString PlayerSessionId;
         for (auto& Pair : PlayerSessions)
         {
@@ -1057,6 +1591,7 @@ void AShooterGameMode::Logout(AController* Exiting)
         {
             RemovePlayerSession(PlayerSessionId);
             CurrentPlayerCount = FMath::Max(0, CurrentPlayerCount - 1);
+            Metrics.AddCounter(MetricHandles.PlayersLeft);
 
 #if WITH_GAMELIFT
             UE_LOG(GameServerLog, Log, TEXT("Player left: %s (Remaining: %d/%d)"),
@@ -1081,15 +1616,55 @@ bool AShooterGameMode::AcceptPlayerSession(const FString& PlayerSessionId)
         return false;
     }
 
-    FGameLiftGenericOutcome Outcome = GameLiftModule->AcceptPlayerSession(TCHAR_TO_UTF8(*PlayerSessionId));
-
-    if (!Outcome.IsSuccess())
+    // Completion runs on the game thread. An accepted pending player gets its pawn and is counted;
+    // a rejected one is kicked.
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    const double StartSeconds = FPlatformTime::Seconds();
+    GameLiftModule->AcceptPlayerSessionAsync(PlayerSessionId, [WeakThis, PlayerSessionId, StartSeconds](FGameLiftGenericOutcome Outcome)
     {
-        FGameLiftError Error = Outcome.GetError();
+        AShooterGameMode* GameMode = WeakThis.Get();
+        if (!GameMode)
+        {
+            return;
+        }
+        GameMode->RecordSdkLatency(GameMode->MetricHandles.SdkAcceptPlayerSessionMs, StartSeconds);
+
+        TWeakObjectPtr<APlayerController> PendingController;
+        const bool bWasPending = GameMode->PendingPlayerSessions.RemoveAndCopyValue(PlayerSessionId, PendingController);
+
+        if (Outcome.IsSuccess())
+        {
+            if (!bWasPending)
+            {
+                return;
+            }
+            if (APlayerController* AcceptedController = PendingController.Get())
+            {
+                GameMode->CompletePlayerJoin(PlayerSessionId, AcceptedController);
+                GameMode->HandleStartingNewPlayer(AcceptedController);
+            }
+            else
+            {
+                // The player left while the call was in flight; release the session it was accepted into
+                GameMode->RemovePlayerSession(PlayerSessionId);
+            }
+            return;
+        }
+
         UE_LOG(GameServerLog, Error, TEXT("AcceptPlayerSession failed for %s: %s"),
-            *PlayerSessionId, *Error.m_errorMessage);
-        return false;
-    }
+            *PlayerSessionId, *Outcome.GetError().m_errorMessage);
+
+        APlayerController* RejectedController = PendingController.Get();
+        if (!bWasPending && GameMode->PlayerSessions.RemoveAndCopyValue(PlayerSessionId, RejectedController))
+        {
+            GameMode->CurrentPlayerCount = FMath::Max(0, GameMode->CurrentPlayerCount - 1);
+        }
+
+        if (RejectedController && GameMode->GameSession)
+        {
+            GameMode->GameSession->KickPlayer(RejectedController, FText::FromString(TEXT("Invalid PlayerSessionId")));
+        }
+    });
 
     return true;
 #else
@@ -1105,15 +1680,21 @@ bool AShooterGameMode::RemovePlayerSession(const FString& PlayerSessionId)
         return false;
     }
 
-    FGameLiftGenericOutcome Outcome = GameLiftModule->RemovePlayerSession(TCHAR_TO_UTF8(*PlayerSessionId));
-
-    if (!Outcome.IsSuccess())
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    const double StartSeconds = FPlatformTime::Seconds();
+    GameLiftModule->RemovePlayerSessionAsync(PlayerSessionId, [WeakThis, PlayerSessionId, StartSeconds](FGameLiftGenericOutcome Outcome)
     {
-        FGameLiftError Error = Outcome.GetError();
-        UE_LOG(GameServerLog, Error, TEXT("RemovePlayerSession failed for %s: %s"),
-            *PlayerSessionId, *Error.m_errorMessage);
-        return false;
-    }
+        if (AShooterGameMode* GameMode = WeakThis.Get())
+        {
+            GameMode->RecordSdkLatency(GameMode->MetricHandles.SdkRemovePlayerSessionMs, StartSeconds);
+        }
+        if (!Outcome.IsSuccess())
+        {
+            FGameLiftError Error = Outcome.GetError();
+            UE_LOG(GameServerLog, Error, TEXT("RemovePlayerSession failed for %s: %s"),
+                *PlayerSessionId, *Error.m_errorMessage);
+        }
+    });
 
     return true;
 #else
@@ -1133,18 +1714,19 @@ void AShooterGameMode::UpdatePlayerSessionCreationPolicy(bool bAcceptingNewPlaye
         EPlayerSessionCreationPolicy::ACCEPT_ALL :
         EPlayerSessionCreationPolicy::DENY_ALL;
 
-    FGameLiftGenericOutcome Outcome = GameLiftModule->UpdatePlayerSessionCreationPolicy(Policy);
-
-    if (!Outcome.IsSuccess())
-    {
-        FGameLiftError Error = Outcome.GetError();
-        UE_LOG(GameServerLog, Error, TEXT("UpdatePlayerSessionCreationPolicy failed: %s"), *Error.m_errorMessage);
-    }
-    else
+    GameLiftModule->UpdatePlayerSessionCreationPolicyAsync(Policy, [bAcceptingNewPlayers](FGameLiftGenericOutcome Outcome)
     {
-        UE_LOG(GameServerLog, Log, TEXT("Player session creation policy updated: %s"),
-            bAcceptingNewPlayers ? TEXT("ACCEPT_ALL") : TEXT("DENY_ALL"));
-    }
+        if (!Outcome.IsSuccess())
+        {
+            FGameLiftError Error = Outcome.GetError();
+            UE_LOG(GameServerLog, Error, TEXT("UpdatePlayerSessionCreationPolicy failed: %s"), *Error.m_errorMessage);
+        }
+        else
+        {
+            UE_LOG(GameServerLog, Log, TEXT("Player session creation policy updated: %s"),
+                bAcceptingNewPlayers ? TEXT("ACCEPT_ALL") : TEXT("DENY_ALL"));
+        }
+    });
 #endif
 }
 
@@ -1161,6 +1743,20 @@ void AShooterGameMode::RequestGameSessionTermination()
     // Clean up the session
     CleanupGameSession();
 
+    if (ServerConfig.bRecycleProcessBetweenSessions)
+    {
+        if (ShouldRecycleProcess())
+        {
+            RecycleProcess();
+        }
+        else
+        {
+            // Past the recycle limits: end the process the normal way and let the fleet start a fresh one
+            HandleProcessTerminate();
+        }
+        return;
+    }
+
     // Note: TerminateGameSession method may not be available in this GameLift SDK version
     // The game session will be terminated automatically when the process ends
     UE_LOG(GameServerLog, Log, TEXT("Game session termination requested - will be handled automatically"));
@@ -1170,6 +1766,146 @@ void AShooterGameMode::RequestGameSessionTermination()
 #endif
 }
 
+#if WITH_GAMELIFT
+bool AShooterGameMode::ShouldRecycleProcess() const
+{
+    if (bIsTerminating)
+    {
+        return false;
+    }
+
+    // Only Anywhere fleets let the process pick the ID it registers under again
+    if (!bIsAnywhereFleet)
+    {
+        UE_LOG(GameServerLog, Log, TEXT("Not recycling: process recycling is only supported on Anywhere fleets"));
+        return false;
+    }
+
+    if (ServerConfig.MaxSessionsPerProcess > 0 && ServerStats.TotalSessionsHosted >= ServerConfig.MaxSessionsPerProcess)
+    {
+        UE_LOG(GameServerLog, Log, TEXT("Not recycling: %d sessions hosted, limit is %d"),
+            ServerStats.TotalSessionsHosted, ServerConfig.MaxSessionsPerProcess);
+        return false;
+    }
+
+    // Leaks that survive a world reset are only reclaimed by a fresh process
+    if (ServerStats.CurrentMemoryUsagePercent > ServerConfig.MaxMemoryUsagePercent)
+    {
+        UE_LOG(GameServerLog, Warning, TEXT("Not recycling: memory usage %.1f%% is above %.1f%%"),
+            ServerStats.CurrentMemoryUsagePercent, ServerConfig.MaxMemoryUsagePercent);
+        return false;
+    }
+
+    return true;
+}
+
+void AShooterGameMode::RecycleProcess()
+{
+    UE_LOG(GameServerLog, Log, TEXT("♻️ Recycling process for the next game session (%d hosted so far)"),
+        ServerStats.TotalSessionsHosted);
+
+    RecycleStartedSeconds = FPlatformTime::Seconds();
+    TransitionToState(EGameLiftServerState::Recycling);
+
+    ResetWorldForNextSession();
+
+    // ProcessEnding ends the game session and this process's registration on the service. The SDK
+    // is then destroyed and initialized again under a new process ID, whose ProcessReady returns the
+    // process to the pool without paying for engine start-up and content loads again.
+    TWeakObjectPtr<AShooterGameMode> WeakThis(this);
+    FGameLiftServerSDKModule* SdkModule = GameLiftModule;
+    GameLiftModule->ProcessEndingAsync([WeakThis, SdkModule](FGameLiftGenericOutcome ProcessEndingOutcome)
+    {
+        AShooterGameMode* GameMode = WeakThis.Get();
+        if (!GameMode || GameMode->ServerState != EGameLiftServerState::Recycling)
+        {
+            return;
+        }
+
+        if (!ProcessEndingOutcome.IsSuccess())
+        {
+            FGameLiftError Error = ProcessEndingOutcome.GetError();
+            UE_LOG(GameServerLog, Error, TEXT("ProcessEnding failed while recycling, shutting down: %s"), *Error.m_errorMessage);
+            GameMode->HandleProcessTerminate();
+            return;
+        }
+
+        FGameLiftGenericOutcome DestroyOutcome = SdkModule->Destroy();
+        GameMode->bIsGameLiftInitialized = false;
+        if (!DestroyOutcome.IsSuccess())
+        {
+            // The service already considers this process ended, so there is nothing left to notify
+            FGameLiftError Error = DestroyOutcome.GetError();
+            UE_LOG(GameServerLog, Error, TEXT("SDK Destroy failed while recycling, shutting down: %s"), *Error.m_errorMessage);
+            GameMode->bIsTerminating = true;
+            GameMode->TransitionToState(EGameLiftServerState::Shutdown);
+            return;
+        }
+
+        // ProcessReady goes out again once the new connection is up
+        GameMode->NumProcessReregistrations++;
+        GameMode->StartupSignals &= ~EGameLiftStartupSignal::SdkConnected;
+        GameMode->bProcessReadyRequested = false;
+        GameMode->InitGameLiftWithRetry(0);
+    });
+}
+#endif
+
+void AShooterGameMode::ResetWorldForNextSession()
+{
+    UWorld* World = GetWorld();
+
+    // Players still connected belong to the session that just ended
+    TArray<APlayerController*> RemainingPlayers;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        APlayerController* PC = It->Get();
+        if (PC && !PC->IsLocalController())
+        {
+            RemainingPlayers.Add(PC);
+        }
+    }
+    for (APlayerController* PC : RemainingPlayers)
+    {
+        if (GameSession)
+        {
+            GameSession->KickPlayer(PC, FText::FromString(TEXT("Game session ended")));
+        }
+    }
+
+    // Bodies and any other pawn nobody controls any more
+    for (TActorIterator<APawn> It(World); It; ++It)
+    {
+        if (!It->GetController())
+        {
+            It->Destroy();
+        }
+    }
+
+    // Pending respawns from the elimination flow
+    for (TPair<APlayerController*, FTimerHandle>& Pair : Timers)
+    {
+        GetWorldTimerManager().ClearTimer(Pair.Value);
+    }
+    Timers.Empty();
+
+    // Players kept around for reconnecting to the old session
+    for (APlayerState* InactivePlayer : InactivePlayerArray)
+    {
+        if (InactivePlayer)
+        {
+            InactivePlayer->Destroy();
+        }
+    }
+    InactivePlayerArray.Empty();
+
+    // Resets every actor that opts in, including the match game state
+    ResetLevel();
+
+    // Reclaim the finished match's objects before the next placement rather than during it
+    GEngine->ForceGarbageCollection(true);
+}
+
 // Cleanup
 void AShooterGameMode::ShutdownGameLift()
 {
@@ -1201,12 +1937,12 @@ void AShooterGameMode::ShutdownGameLift()
 
 void AShooterGameMode::CleanupGameSession()
 {
-    FScopeLock Lock(&SessionLock);
-
     if (bIsGameSessionActive)
     {
         UE_LOG(GameServerLog, Log, TEXT("Cleaning up game session: %s"), *CurrentGameSessionId);
 
+        ExportMatchFrameTimes();
+
         // Notify blueprints
 #if WITH_GAMELIFT
         OnGameSessionTerminated.Broadcast(TEXT("Session ended"));
@@ -1222,9 +1958,47 @@ void AShooterGameMode::CleanupGameSession()
         MaxPlayers = 0;
         GameSessionProperties.Empty();
         PlayerSessions.Empty();
+        PendingPlayerSessions.Empty();
+#if WITH_GAMELIFT
+        MatchmakerData.Reset();
+#endif
     }
 }
 
+void AShooterGameMode::ExportMatchFrameTimes()
+{
+    const FGameLiftFrameTimeSummary MatchSummary = FrameTimes.SummarizeMatch();
+    if (MatchSummary.FrameCount == 0)
+    {
+        return;
+    }
+
+    UE_LOG(GameServerLog, Log, TEXT("Match frame times over %d frames: mean %.2f ms, p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms"),
+        MatchSummary.FrameCount, MatchSummary.MeanMs, MatchSummary.P50Ms, MatchSummary.P95Ms, MatchSummary.P99Ms, MatchSummary.MaxMs);
+    UE_LOG(GameServerLog, Log, TEXT("Match frame phases per frame: work %.2f ms, idle %.2f ms, SDK commands %.3f ms"),
+        MatchSummary.WorkMs, MatchSummary.IdleMs, MatchSummary.SdkCommandsMs);
+    for (int32 Index = 0; Index < FMath::Min(ServerConfig.HitchThresholdsMs.Num(), FGameLiftFrameTimeSummary::MaxHitchThresholds); ++Index)
+    {
+        UE_LOG(GameServerLog, Log, TEXT("Match hitches >= %.0f ms: %d"), ServerConfig.HitchThresholdsMs[Index], MatchSummary.HitchCounts[Index]);
+    }
+
+    RecordHealthMetric(MetricHandles.MatchFrameTimeP99Ms, MatchSummary.P99Ms);
+    RecordHealthMetric(MetricHandles.MatchFrameTimeMaxMs, MatchSummary.MaxMs);
+
+    // Full histogram next to the server log, written off the game thread
+    const FString CsvPath = ServerConfig.LogDirectory + FString::Printf(TEXT("frametimes_%s.csv"),
+        *FPaths::MakeValidFileName(CurrentGameSessionId.IsEmpty() ? FDateTime::Now().ToString() : CurrentGameSessionId, TEXT('_')));
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [CsvPath, Csv = FrameTimes.ExportMatchCsv()]()
+    {
+        if (!FFileHelper::SaveStringToFile(Csv, *CsvPath))
+        {
+            UE_LOG(GameServerLog, Warning, TEXT("Could not write match frame times to %s"), *CsvPath);
+        }
+    });
+
+    FrameTimes.ResetMatch();
+}
+
 void AShooterGameMode::SaveServerLogs()
 {
     // Implement log saving if needed
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Templates/Function.h"
+#include <atomic>
+
+enum class EGameLiftCommandKind : uint8
+{
+    // Dropped, with an error, when the queue is full
+    Droppable,
+    // Session and process lifecycle events. Never dropped: queued past Capacity, with a warning,
+    // since losing one would leave the server out of step with GameLift.
+    Lifecycle
+};
+
+/**
+ * Bounded multi-producer, single-consumer queue of work for the game thread.
+ *
+ * GameLift SDK callbacks arrive on SDK threads; they enqueue a command here instead of touching the
+ * game mode, and the game thread runs the commands from Tick within a per-frame time budget. This
+ * keeps all session, player and world state single-threaded.
+ */
+class FGameLiftCommandQueue
+{
+public:
+    struct FStats
+    {
+        int32 MaxDepth = 0;
+        int32 Executed = 0;
+        int32 Rejected = 0;
+        double MaxLatencySeconds = 0.0;
+        double TotalLatencySeconds = 0.0;
+    };
+
+    static constexpr int32 DefaultCapacity = 64;
+
+    // Default-constructible so it can live in a UObject, whose vtable-helper constructor builds every member
+    explicit FGameLiftCommandQueue(int32 InCapacity = DefaultCapacity);
+
+    // Any thread. Returns false, and drops the command, if the queue already holds Capacity commands
+    // and the command is Droppable. Lifecycle commands are always queued.
+    bool Enqueue(const TCHAR* Name, EGameLiftCommandKind Kind, TUniqueFunction<void()> Work);
+
+    // Game thread only. Runs queued commands until the queue is empty or BudgetSeconds have passed.
+    // At least one command runs per call, so a slow command cannot starve the rest forever.
+    int32 Drain(double BudgetSeconds);
+
+    // Game thread only. Returns depth and latency figures since the previous call and resets them.
+    FStats ConsumeStats();
+
+private:
+    struct FCommand
+    {
+        const TCHAR* Name;
+        TUniqueFunction<void()> Work;
+        double EnqueuedAtSeconds;
+    };
+
+    TQueue<FCommand, EQueueMode::Mpsc> Commands;
+    const int32 Capacity;
+    std::atomic<int32> Depth;
+    std::atomic<int32> Rejected;
+
+    // Consumer side only
+    FStats WindowStats;
+};
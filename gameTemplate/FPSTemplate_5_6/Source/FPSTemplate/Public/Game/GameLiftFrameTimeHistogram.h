@@ -0,0 +1,139 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Log-linear histogram of durations in microseconds, in the style of HdrHistogram.
+ *
+ * Every power of two is split into 16 linear buckets, so a reported percentile is within about 6%
+ * of the true value across the whole range (1 us to ~67 s). Recording and removing are O(1) and
+ * the storage is fixed, so it can sit on the game thread's per-frame path.
+ */
+class FGameLiftLatencyHistogram
+{
+public:
+    FGameLiftLatencyHistogram();
+
+    void Record(uint32 Microseconds);
+    // Undoes a previous Record() of the same value; used to slide a window.
+    void Remove(uint32 Microseconds);
+    void Merge(const FGameLiftLatencyHistogram& Other);
+    void Reset();
+
+    uint64 GetCount() const { return TotalCount; }
+
+    // Smallest bucket upper bound that at least Fraction of the samples are at or below.
+    uint32 GetPercentile(double Fraction) const;
+
+    // Calls Visitor(UpperBoundMicroseconds, Count) for each non-empty bucket, in ascending order.
+    template <typename VisitorType>
+    void ForEachBucket(VisitorType&& Visitor) const
+    {
+        for (int32 Index = 0; Index < NumBuckets; ++Index)
+        {
+            if (Counts[Index] > 0)
+            {
+                Visitor(GetBucketUpperBound(Index), Counts[Index]);
+            }
+        }
+    }
+
+    // One "upper_bound_us,count" line per non-empty bucket, preceded by a header line.
+    FString ToCsv() const;
+
+private:
+    static constexpr int32 SubBucketBits = 4;
+    static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+    static constexpr int32 MaxExponent = 26;
+    static constexpr int32 NumBuckets = SubBucketCount + (MaxExponent - SubBucketBits) * SubBucketCount;
+
+    static int32 GetBucketIndex(uint32 Microseconds);
+    static uint32 GetBucketUpperBound(int32 Index);
+
+    uint32 Counts[NumBuckets];
+    uint64 TotalCount;
+};
+
+/**
+ * Frame-time figures over a window of frames. Times are in milliseconds.
+ */
+struct FGameLiftFrameTimeSummary
+{
+    static constexpr int32 MaxHitchThresholds = 4;
+
+    int32 FrameCount = 0;
+    float MeanMs = 0.0f;
+    float P50Ms = 0.0f;
+    float P95Ms = 0.0f;
+    float P99Ms = 0.0f;
+    float MaxMs = 0.0f;
+
+    // Mean time per frame spent in each phase of the game thread's frame
+    float WorkMs = 0.0f;
+    float IdleMs = 0.0f;
+    float SdkCommandsMs = 0.0f;
+
+    // Frames at or above each configured hitch threshold, in threshold order
+    int32 HitchCounts[MaxHitchThresholds] = {};
+};
+
+/**
+ * Game thread frame-time tracker.
+ *
+ * A fixed ring of the last WindowFrames frame times feeds a sliding histogram, so percentiles
+ * cover a recent window without ever shifting or re-sorting samples. A second histogram covers the
+ * whole match for export when it ends. Single-threaded: other threads see the figures through the
+ * published health snapshot.
+ */
+class FGameLiftFrameTimeTracker
+{
+public:
+    FGameLiftFrameTimeTracker();
+
+    // Thresholds beyond FGameLiftFrameTimeSummary::MaxHitchThresholds are ignored.
+    void SetHitchThresholds(const TArray<float>& ThresholdsMs);
+
+    void RecordFrame(double FrameSeconds, double IdleSeconds, double SdkCommandSeconds);
+
+    // Percentiles over the sliding window; phases and hitches since the previous call, which resets them.
+    FGameLiftFrameTimeSummary ConsumeWindow();
+
+    // Everything recorded since the last ResetMatch().
+    FGameLiftFrameTimeSummary SummarizeMatch() const;
+    FString ExportMatchCsv() const { return MatchHistogram.ToCsv(); }
+    void ResetMatch();
+
+private:
+    struct FPhaseTotals
+    {
+        double WorkSeconds = 0.0;
+        double IdleSeconds = 0.0;
+        double SdkCommandSeconds = 0.0;
+        int32 Frames = 0;
+        int32 HitchCounts[FGameLiftFrameTimeSummary::MaxHitchThresholds] = {};
+    };
+
+    static void FillPhases(const FPhaseTotals& Totals, FGameLiftFrameTimeSummary& OutSummary);
+    static void FillPercentiles(const FGameLiftLatencyHistogram& Histogram, FGameLiftFrameTimeSummary& OutSummary);
+
+    // About 30 to 60 seconds of frames at typical server tick rates
+    static constexpr int32 WindowFrames = 2048;
+
+    uint32 RingMicroseconds[WindowFrames];
+    int32 RingHead;
+    int32 RingCount;
+    uint64 RingSumMicroseconds;
+    FGameLiftLatencyHistogram WindowHistogram;
+
+    FGameLiftLatencyHistogram MatchHistogram;
+    uint64 MatchSumMicroseconds;
+    uint32 MatchMaxMicroseconds;
+
+    uint32 HitchThresholdsMicroseconds[FGameLiftFrameTimeSummary::MaxHitchThresholds];
+    int32 NumHitchThresholds;
+
+    FPhaseTotals WindowPhases;
+    FPhaseTotals MatchPhases;
+};
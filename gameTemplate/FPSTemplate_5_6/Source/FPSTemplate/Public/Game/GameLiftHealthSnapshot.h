@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include <type_traits>
+
+/**
+ * Health inputs the game thread samples once per statistics update, so the GameLift health
+ * callback can judge the server without touching world state or UObjects from an SDK thread.
+ */
+struct FGameLiftHealthSnapshot
+{
+    // FPlatformTime::Seconds() when the game thread published this snapshot. A stalled game loop
+    // stops publishing, so the age of the snapshot is the stall time.
+    double PublishedAtSeconds = 0.0;
+    float AverageTickRate = 0.0f;
+    // Frame-time percentiles over the game thread's recent frame window, in milliseconds.
+    float FrameTimeP50Ms = 0.0f;
+    float FrameTimeP99Ms = 0.0f;
+    float FrameTimeMaxMs = 0.0f;
+    float MemoryUsagePercent = 0.0f;
+    // Frames since the previous snapshot at or above the first configured hitch threshold.
+    int32 HitchCount = 0;
+    int32 PlayerCount = 0;
+    bool bIsGameSessionActive = false;
+    // Result of PerformCustomHealthCheck(), which may read game state and so runs on the game thread.
+    bool bCustomHealthCheckPassed = true;
+};
+
+/**
+ * Single-writer seqlock holding the latest published value of a trivially copyable type.
+ *
+ * Publish() never waits. Read() never takes a lock; it only retries if it overlaps a Publish(),
+ * which with one publish a second is effectively never. The value is held in atomic words, so a
+ * torn copy is detected and discarded rather than being undefined behaviour.
+ */
+template <typename T>
+class TGameLiftSeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "TGameLiftSeqLock requires a trivially copyable type");
+
+public:
+    // Must only be called from one thread at a time.
+    void Publish(const T& Value)
+    {
+        uint64 Words[NumWords] = {};
+        FMemory::Memcpy(Words, &Value, sizeof(T));
+
+        const uint32 Begin = Sequence.load(std::memory_order_relaxed);
+        Sequence.store(Begin + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (int32 Index = 0; Index < NumWords; ++Index)
+        {
+            Data[Index].store(Words[Index], std::memory_order_relaxed);
+        }
+        Sequence.store(Begin + 2, std::memory_order_release);
+    }
+
+    // Returns false if nothing has been published yet.
+    bool Read(T& OutValue) const
+    {
+        uint64 Words[NumWords];
+        uint32 Begin;
+        do
+        {
+            Begin = Sequence.load(std::memory_order_acquire);
+            for (int32 Index = 0; Index < NumWords; ++Index)
+            {
+                Words[Index] = Data[Index].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        while ((Begin & 1) != 0 || Sequence.load(std::memory_order_relaxed) != Begin);
+
+        if (Begin == 0)
+        {
+            return false;
+        }
+        FMemory::Memcpy(&OutValue, Words, sizeof(T));
+        return true;
+    }
+
+private:
+    static constexpr int32 NumWords = (sizeof(T) + sizeof(uint64) - 1) / sizeof(uint64);
+
+    std::atomic<uint32> Sequence{0};
+    std::atomic<uint64> Data[NumWords] = {};
+};
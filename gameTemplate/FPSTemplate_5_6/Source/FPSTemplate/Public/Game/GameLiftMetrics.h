@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/UniquePtr.h"
+#include <atomic>
+
+enum class EGameLiftMetricType : uint8
+{
+    Counter,
+    Gauge,
+    Histogram
+};
+
+/**
+ * Registered metric. Resolve a name once and keep the handle on hot paths to skip the name lookup.
+ */
+struct FGameLiftMetricHandle
+{
+    int32 Index = INDEX_NONE;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * One metric's value over a flush interval, as handed to exporters.
+ */
+struct FGameLiftMetricSample
+{
+    FName Name;
+    EGameLiftMetricType Type = EGameLiftMetricType::Gauge;
+
+    // Counter: increase over the interval. Gauge: latest value set. Histogram: unused.
+    double Value = 0.0;
+
+    // Histograms only, in the unit the values were recorded in
+    uint64 Count = 0;
+    double Sum = 0.0;
+    double Min = 0.0;
+    double Max = 0.0;
+    double P50 = 0.0;
+    double P95 = 0.0;
+    double P99 = 0.0;
+};
+
+/**
+ * Destination for collected metrics.
+ */
+class IGameLiftMetricsExporter
+{
+public:
+    virtual ~IGameLiftMetricsExporter() = default;
+
+    virtual const TCHAR* GetName() const = 0;
+
+    // Runs on a background thread, never concurrently with another Export() on the same registry.
+    virtual void Export(const TArray<FGameLiftMetricSample>& Samples, const FDateTime& Timestamp) = 0;
+};
+
+/**
+ * Counters, gauges and histograms that any thread can record into.
+ *
+ * Each recording thread writes to its own shard behind a lock only the collector ever contends, so
+ * recording costs a thread-local lookup and an uncontended lock. Flush() merges the shards on the
+ * game thread and hands the result to the exporters on a background thread, keeping network and
+ * file I/O off the frame.
+ *
+ * Histogram values are kept to three decimal places between 0 and about 67,000, which suits
+ * latencies in milliseconds.
+ */
+class FGameLiftMetricsRegistry
+{
+public:
+    static constexpr int32 MaxMetrics = 256;
+
+    FGameLiftMetricsRegistry();
+    ~FGameLiftMetricsRegistry();
+
+    // Any thread. Returns the existing handle if Name is already registered with the same type,
+    // and an invalid handle if it is registered with another type or the registry is full.
+    FGameLiftMetricHandle Register(FName Name, EGameLiftMetricType Type);
+
+    // Any thread. Invalid handles are ignored.
+    void AddCounter(FGameLiftMetricHandle Handle, int64 Delta = 1);
+    void SetGauge(FGameLiftMetricHandle Handle, double Value);
+    void RecordHistogram(FGameLiftMetricHandle Handle, double Value);
+
+    // Any thread. NAME_None for an invalid handle.
+    FName GetName(FGameLiftMetricHandle Handle) const { return Handle.IsValid() ? MetricNames[Handle.Index] : NAME_None; }
+
+    void AddCounter(FName Name, int64 Delta = 1) { AddCounter(Register(Name, EGameLiftMetricType::Counter), Delta); }
+    void SetGauge(FName Name, double Value) { SetGauge(Register(Name, EGameLiftMetricType::Gauge), Value); }
+    void RecordHistogram(FName Name, double Value) { RecordHistogram(Register(Name, EGameLiftMetricType::Histogram), Value); }
+
+    // Game thread, before the first Flush().
+    void AddExporter(TUniquePtr<IGameLiftMetricsExporter> Exporter);
+    bool HasExporters() const;
+
+    // Any thread. Merges every shard into one sample per metric recorded since the previous call.
+    TArray<FGameLiftMetricSample> Collect();
+
+    // Game thread. Collects and exports on a background thread.
+    void Flush();
+
+private:
+    struct FShard;
+    struct FExportState;
+
+    FShard& GetShard();
+
+    // Unique per registry, so a thread's cached shard is never mistaken for one of a destroyed registry
+    const uint64 RegistryId;
+
+    mutable FRWLock MetricsLock;
+    TMap<FName, int32> MetricIndices;
+    FName MetricNames[MaxMetrics];
+    EGameLiftMetricType MetricTypes[MaxMetrics];
+    std::atomic<int32> NumMetrics;
+
+    FCriticalSection ShardsLock;
+    TArray<TUniquePtr<FShard>> Shards;
+
+    // Orders gauge writes from different threads, so the latest one wins when shards are merged
+    std::atomic<uint64> GaugeSequence;
+
+    TSharedRef<FExportState, ESPMode::ThreadSafe> ExportState;
+};
@@ -0,0 +1,67 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Game/GameLiftMetrics.h"
+
+class FSocket;
+class FInternetAddr;
+
+/**
+ * Sends metrics to a StatsD agent over UDP.
+ *
+ * Counters go out as "|c" and gauges as "|g". Histograms are already aggregated, so they go out as
+ * gauges per statistic (name.p50, name.p99, name.max, ...) plus a name.count counter. To try it
+ * locally, point it at 127.0.0.1 and listen with "nc -ul 8125".
+ */
+class FGameLiftStatsDExporter : public IGameLiftMetricsExporter
+{
+public:
+    FGameLiftStatsDExporter(const FString& InHost, int32 InPort, const FString& InPrefix);
+    virtual ~FGameLiftStatsDExporter() override;
+
+    virtual const TCHAR* GetName() const override { return TEXT("StatsD"); }
+    virtual void Export(const TArray<FGameLiftMetricSample>& Samples, const FDateTime& Timestamp) override;
+
+private:
+    // Resolves the host on the export thread, so a slow DNS lookup never blocks the game thread
+    bool EnsureSocket();
+    void AppendLine(TArray<ANSICHAR>& Packet, const FString& Line);
+    void SendPacket(TArray<ANSICHAR>& Packet);
+
+    // Fits one Ethernet MTU with IP and UDP headers, so datagrams are not fragmented
+    static constexpr int32 MaxPacketBytes = 1432;
+
+    const FString Host;
+    const int32 Port;
+    const FString Prefix;
+
+    FSocket* Socket;
+    TSharedPtr<FInternetAddr> Address;
+    bool bResolveFailed;
+};
+
+/**
+ * Appends metrics as CloudWatch embedded metric format (EMF) JSON lines to a file.
+ *
+ * The CloudWatch agent tails the file and turns each line into metrics with no PutMetricData calls.
+ * Histograms are written as one metric per statistic, as with StatsD.
+ */
+class FGameLiftEmfFileExporter : public IGameLiftMetricsExporter
+{
+public:
+    // Properties are written on every line as searchable, non-metric fields.
+    FGameLiftEmfFileExporter(const FString& InFilePath, const FString& InNamespace, const TMap<FString, FString>& InProperties);
+
+    virtual const TCHAR* GetName() const override { return TEXT("CloudWatch EMF file"); }
+    virtual void Export(const TArray<FGameLiftMetricSample>& Samples, const FDateTime& Timestamp) override;
+
+private:
+    // CloudWatch rejects documents that declare more metrics than this
+    static constexpr int32 MaxMetricsPerDocument = 100;
+
+    const FString FilePath;
+    const FString Namespace;
+    FString PropertiesJson;
+};
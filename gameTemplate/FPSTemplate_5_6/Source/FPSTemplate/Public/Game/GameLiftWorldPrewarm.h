@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Templates/Function.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FStreamableHandle;
+
+/**
+ * Async loader for the content a match needs before its first player joins.
+ *
+ * The game mode requests a process-wide set once ProcessReady succeeds and a map-specific set when
+ * a session starts; session activation waits on WhenComplete() rather than on synchronous loads.
+ * Each stage keeps one handle, so requesting a stage again only loads what it does not have yet.
+ * Loaded assets stay resident until Reset().
+ */
+class FGameLiftWorldPrewarm
+{
+public:
+    FGameLiftWorldPrewarm();
+    ~FGameLiftWorldPrewarm();
+
+    // Game thread only. Starts an async load of Assets alongside any loads already in flight. Assets
+    // already requested under the same Stage are neither loaded nor counted again.
+    void Request(const TCHAR* Stage, const TArray<FSoftObjectPath>& Assets);
+
+    // True when nothing requested so far is still loading.
+    bool IsComplete() const { return PendingLoads == 0; }
+
+    // Game thread only. Runs Callback once IsComplete(); immediately if it already is. If loads are
+    // still running after TimeoutSeconds, logs the late stages and runs Callback anyway; a timeout of
+    // zero or less waits for as long as the loads take.
+    void WhenComplete(float TimeoutSeconds, TUniqueFunction<void()> Callback);
+
+    // Game thread only. Cancels in-flight loads, drops waiting callbacks and releases loaded assets.
+    void Reset();
+
+    int32 GetNumResidentAssets() const { return ResidentAssets; }
+
+private:
+    struct FStage
+    {
+        TSharedPtr<FStreamableHandle> Handle;
+        TArray<FSoftObjectPath> Assets;
+        int32 NumResident = 0;
+        double StartSeconds = 0.0;
+        bool bLoading = false;
+    };
+
+    struct FWaiter
+    {
+        int32 Id = 0;
+        TUniqueFunction<void()> Callback;
+        FTSTicker::FDelegateHandle DeadlineHandle;
+    };
+
+    void HandleLoadComplete(FString StageName);
+    bool HandleWaiterDeadline(float DeltaTime, int32 WaiterId, float TimeoutSeconds);
+    void FinishLoad();
+
+    TMap<FString, FStage> Stages;
+    TArray<FWaiter> Waiters;
+    int32 NextWaiterId;
+    int32 PendingLoads;
+    int32 ResidentAssets;
+};
@@ -23,6 +23,7 @@ public:
 	void UpdateLeader();
 	bool HasFirstBloodBeenHad() const { return bHasFirstBloodBeenHad; }
 	bool IsTiedForTheLead(AMatchPlayerState* PlayerState);
+	virtual void Reset() override;
 protected:
 	virtual void BeginPlay() override;
 private:
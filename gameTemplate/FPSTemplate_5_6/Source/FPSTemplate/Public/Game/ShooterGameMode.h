@@ -4,6 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Game/ShooterGameModeBase.h"
+#include "Game/GameLiftCommandQueue.h"
+#include "Game/GameLiftFrameTimeHistogram.h"
+#include "Game/GameLiftHealthSnapshot.h"
+#include "Game/GameLiftMetrics.h"
+#include "Game/GameLiftWorldPrewarm.h"
 #include "TimerManager.h"
 #include "ShooterGameMode.generated.h"
 
@@ -13,6 +18,9 @@
 #endif
 
 struct FProcessParameters;
+class AWeapon;
+class UAnimMontage;
+class UWeaponData;
 namespace Aws {
     namespace GameLift {
         namespace Server {
@@ -44,11 +52,33 @@ enum class EGameLiftServerState : uint8
     Ready           UMETA(DisplayName = "Ready"),
     ActivatingSession UMETA(DisplayName = "Activating Session"),
     InSession       UMETA(DisplayName = "In Session"),
+    Recycling       UMETA(DisplayName = "Recycling"),
     Terminating     UMETA(DisplayName = "Terminating"),
     Error           UMETA(DisplayName = "Error"),
     Shutdown        UMETA(DisplayName = "Shutdown")
 };
 
+/**
+ * Content to load ahead of a match so the first players do not pay for it
+ */
+USTRUCT(BlueprintType)
+struct FGameLiftPrewarmSet
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Prewarm")
+    TArray<TSoftObjectPtr<UWeaponData>> WeaponData;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Prewarm")
+    TArray<TSoftClassPtr<AWeapon>> WeaponClasses;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Prewarm")
+    TArray<TSoftObjectPtr<UAnimMontage>> Montages;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Prewarm")
+    TArray<TSoftClassPtr<APawn>> PlayerClasses;
+};
+
 /**
  * Configuration for GameLift server
  */
@@ -78,9 +108,34 @@ struct FGameLiftServerConfig
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
     float MaxGameLoopStallSeconds = 5.0f;
 
+    // Frames at or above each threshold are counted as hitches; the first one feeds the health snapshot.
+    // Up to four thresholds are tracked.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    TArray<float> HitchThresholdsMs = { 100.0f, 250.0f, 1000.0f };
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
     bool bEnableDetailedLogging = false;
 
+    // StatsD agent for metrics over UDP; empty to disable
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    FString StatsDHost;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    int32 StatsDPort = 8125;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    FString MetricsPrefix = TEXT("gameliftserver");
+
+    // Append CloudWatch embedded metric format lines to metrics.emf.log in the log directory
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    bool bWriteEmfMetrics = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    FString EmfNamespace = TEXT("GameLiftServer");
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    float MetricsFlushIntervalSeconds = 10.0f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
     bool bAutoShutdownOnTerminate = true;
 
@@ -89,8 +144,53 @@ struct FGameLiftServerConfig
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
     TArray<FString> AdditionalLogFiles;
+
+    // Loaded in parallel with SDK start-up; ProcessReady is not sent until they are resident
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    TArray<FSoftObjectPath> StartupPrewarmAssets;
+
+    // Loaded after ProcessReady for every match, together with the default pawn class
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    FGameLiftPrewarmSet MatchPrewarm;
+
+    // Extra content per map, keyed by map name; picked from the session's MapGamePropertyKey property,
+    // or the current map if the session does not name one
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    TMap<FString, FGameLiftPrewarmSet> MapPrewarm;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    FString MapGamePropertyKey = TEXT("map");
+
+    // Longest a session activation waits on match prewarm; the session activates anyway after this
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    float PrewarmTimeoutSeconds = 10.0f;
+
+    // Reset the world and register with GameLift again when a session ends, instead of exiting the process.
+    // Anywhere fleets only: the process sends ProcessEnding, destroys the SDK and re-runs InitSDK under a
+    // new process ID before ProcessReady. Managed fleets own the process ID and expect the process to exit
+    // after ProcessEnding, so there the flag is ignored and the session ends the process as usual.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    bool bRecycleProcessBetweenSessions = false;
+
+    // Sessions a recycled process hosts before it exits anyway; 0 for no limit
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameLift Config")
+    int32 MaxSessionsPerProcess = 0;
 };
 
+/**
+ * Signals that must all be in before the server calls ProcessReady
+ */
+enum class EGameLiftStartupSignal : uint8
+{
+    None         = 0,
+    SdkConnected = 1 << 0,
+    WorldReady   = 1 << 1,
+    LogsReady    = 1 << 2,
+    AssetsWarm   = 1 << 3,
+    All          = SdkConnected | WorldReady | LogsReady | AssetsWarm
+};
+ENUM_CLASS_FLAGS(EGameLiftStartupSignal);
+
 /**
  * Runtime statistics for monitoring
  */
@@ -111,6 +211,23 @@ struct FGameLiftServerStats
     UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
     float AverageTickRate = 0.0f;
 
+    // Frame-time percentiles over the recent frame window
+    UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
+    float FrameTimeP50Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
+    float FrameTimeP95Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
+    float FrameTimeP99Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
+    float FrameTimeMaxMs = 0.0f;
+
+    // Frames at or above the first hitch threshold since the server started
+    UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
+    int32 TotalHitches = 0;
+
     UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
     FDateTime ServerStartTime;
 
@@ -119,6 +236,58 @@ struct FGameLiftServerStats
 
     UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
     int32 ConsecutiveHealthCheckFailures = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
+    int32 TotalProcessRecycles = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "GameLift Stats")
+    float LastRecycleSeconds = 0.0f;
+};
+
+/**
+ * Every metric the game mode reports, registered once so recording skips the name lookup.
+ * Default-constructed handles are invalid, and recording into them is a no-op.
+ */
+struct FGameLiftServerMetricHandles
+{
+    FGameLiftServerMetricHandles() = default;
+    explicit FGameLiftServerMetricHandles(FGameLiftMetricsRegistry& Registry);
+
+    // Gauges
+    FGameLiftMetricHandle TickRate;
+    FGameLiftMetricHandle MemoryUsage;
+    FGameLiftMetricHandle PlayerCount;
+    FGameLiftMetricHandle HitchCount;
+    FGameLiftMetricHandle FrameTimeP50Ms;
+    FGameLiftMetricHandle FrameTimeP95Ms;
+    FGameLiftMetricHandle FrameTimeP99Ms;
+    FGameLiftMetricHandle FrameTimeMaxMs;
+    FGameLiftMetricHandle FrameWorkMs;
+    FGameLiftMetricHandle FrameIdleMs;
+    FGameLiftMetricHandle FrameSdkCommandsMs;
+    FGameLiftMetricHandle MatchFrameTimeP99Ms;
+    FGameLiftMetricHandle MatchFrameTimeMaxMs;
+    FGameLiftMetricHandle CommandQueueMaxDepth;
+    FGameLiftMetricHandle CommandQueueMaxLatencyMs;
+    FGameLiftMetricHandle CommandQueueAvgLatencyMs;
+    FGameLiftMetricHandle LaunchToActiveMs;
+    FGameLiftMetricHandle SessionStartToActiveMs;
+    FGameLiftMetricHandle RecycleMs;
+    FGameLiftMetricHandle RecycleUsedMemoryMB;
+
+    // Counters
+    FGameLiftMetricHandle HealthChecksPassed;
+    FGameLiftMetricHandle HealthChecksFailed;
+    FGameLiftMetricHandle Hitches;
+    FGameLiftMetricHandle SdkCallbacksDropped;
+    FGameLiftMetricHandle PlayersJoined;
+    FGameLiftMetricHandle PlayersLeft;
+
+    // SDK call latency histograms
+    FGameLiftMetricHandle SdkProcessReadyMs;
+    FGameLiftMetricHandle SdkActivateGameSessionMs;
+    FGameLiftMetricHandle SdkAcceptPlayerSessionMs;
+    FGameLiftMetricHandle SdkRemovePlayerSessionMs;
 };
 
 
@@ -168,6 +337,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GameLift")
     FGameLiftServerStats GetServerStats() const { return ServerStats; }
 
+    // Team the matchmaker placed the player on, or empty when the session has no matchmaker data.
+    // Reads the pre-parsed matchmaker view, so no JSON is parsed on the caller's thread.
+    UFUNCTION(BlueprintCallable, Category = "GameLift")
+    FString GetMatchmakerTeamForPlayer(const FString& PlayerId) const;
+
+    // Player session calls are issued asynchronously; the return value only reports whether the
+    // request was dispatched. Completions run on the game thread: an accepted pending player joins
+    // the match, a rejected one is kicked.
     UFUNCTION(BlueprintCallable, Category = "GameLift")
     bool AcceptPlayerSession(const FString& PlayerSessionId);
 
@@ -190,6 +367,8 @@ protected:
     virtual void PreLogin(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage) override;
     virtual APlayerController* Login(UPlayer* NewPlayer, ENetRole InRemoteRole, const FString& Portal, const FString& Options, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage) override;
     virtual void Logout(AController* Exiting) override;
+    // Holds back the pawn of a player whose session GameLift has not accepted yet
+    virtual void HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer) override;
 
     // Virtual functions for game-specific implementation
     virtual bool ValidateGameSessionProperties(const TMap<FString, FString>& Properties);
@@ -208,14 +387,21 @@ private:
 #if WITH_GAMELIFT
     void InitGameLift();
     void InitGameLiftWithRetry(int32 AttemptNumber = 0);
+    void HandleSdkInitialized(const FGameLiftGenericOutcome& InitOutcome, int32 AttemptNumber);
+    void StartStartupPrewarm();
+    void MarkStartupSignal(EGameLiftStartupSignal Signal);
+    void CallProcessReady();
     void SetupGameLiftCallbacks();
     void ParseGameLiftAnywhereParameters(struct FServerParameters& OutParams);
     bool ValidateServerConfiguration();
 #endif
     void ParseCommandLineArguments();
 
-    // State management
-    void TransitionToState(EGameLiftServerState NewState);
+    // Logs and bookmarks a start-up milestone; returns seconds since process launch
+    double MarkStartupMilestone(const TCHAR* Milestone) const;
+
+    // State management. Returns false, leaving the state unchanged, if the transition is not allowed.
+    bool TransitionToState(EGameLiftServerState NewState);
     bool CanTransitionToState(EGameLiftServerState NewState) const;
     void HandleStateTransition(EGameLiftServerState OldState, EGameLiftServerState NewState);
 
@@ -224,30 +410,45 @@ private:
     void HandleGameSessionStart(const Aws::GameLift::Server::Model::GameSession& InGameSession);
     void HandleProcessTerminate();
     void HandleGameSessionUpdate(const Aws::GameLift::Server::Model::UpdateGameSession& UpdateGameSession);
+    void ActivateGameSession();
+    void StartWorldPrewarm();
+    void RequestMapPrewarm(const FString& MapName);
+    bool ShouldRecycleProcess() const;
+    void RecycleProcess();
 #endif
+    void ResetWorldForNextSession();
+    // Runs on an SDK thread. Reads only the published health snapshot and the server state mirror.
     bool HandleHealthCheck();
 
     // Health monitoring
     void PerformHealthCheck();
     void UpdateServerStatistics();
-    bool CheckMemoryHealth();
-    bool CheckGameLoopHealth();
-    void RecordHealthMetric(const FString& MetricName, float Value);
+    void PublishHealthSnapshot(const FGameLiftFrameTimeSummary& FrameSummary);
+    bool EvaluateHealth(const FGameLiftHealthSnapshot& Snapshot, FString& OutDetails) const;
+    bool CheckMemoryHealth(const FGameLiftHealthSnapshot& Snapshot) const;
+    bool CheckGameLoopHealth(const FGameLiftHealthSnapshot& Snapshot) const;
+    void RecordHealthMetric(FGameLiftMetricHandle Metric, float Value);
+    void RecordSdkLatency(FGameLiftMetricHandle Metric, double StartSeconds);
+
+    // Counts an accepted player and announces the join
+    void CompletePlayerJoin(const FString& PlayerSessionId, APlayerController* PlayerController);
+    void ConfigureMetricsExporters();
 
     // Cleanup
     void ShutdownGameLift();
     void CleanupGameSession();
     void SaveServerLogs();
+    void ExportMatchFrameTimes();
 
     // Timer handles
     FTimerHandle HealthCheckTimerHandle;
     FTimerHandle StatisticsUpdateTimerHandle;
     FTimerHandle RetryInitTimerHandle;
+    FTimerHandle MetricsFlushTimerHandle;
 
-    // Thread safety
-    mutable FCriticalSection StateLock;
-    mutable FCriticalSection SessionLock;
-    mutable FCriticalSection PlayerLock;
+    // SDK callbacks run on SDK threads and hand their work to the game thread through this queue,
+    // so state, session and player members below are only ever touched on the game thread.
+    FGameLiftCommandQueue GameThreadCommands;
 
     // State variables
     EGameLiftServerState ServerState;
@@ -262,18 +463,33 @@ private:
     int32 MaxPlayers;
     TMap<FString, FString> GameSessionProperties;
     TMap<FString, APlayerController*> PlayerSessions;
+    // Connected, but waiting for AcceptPlayerSession; no pawn and not counted until it succeeds
+    TMap<FString, TWeakObjectPtr<APlayerController>> PendingPlayerSessions;
 
     // Statistics and monitoring
     FGameLiftServerStats ServerStats;
     float LastTickTime;
-    float TickTimeAccumulator;
-    int32 TickCounter;
-    TArray<float> RecentTickRates;
+    FGameLiftFrameTimeTracker FrameTimes;
+
+    // Time series for everything RecordHealthMetric and the SDK call sites report; any thread may record
+    FGameLiftMetricsRegistry Metrics;
+    FGameLiftServerMetricHandles MetricHandles;
+
+    // Written by the game thread, read wait-free by the SDK health callback.
+    TGameLiftSeqLock<FGameLiftHealthSnapshot> HealthSnapshot;
+    // Copy of ServerState for the health callback, which stays on its SDK thread.
+    std::atomic<EGameLiftServerState> PublishedServerState;
 
     // GameLift SDK
 #if WITH_GAMELIFT
     TSharedPtr<FProcessParameters> ProcessParameters;
     class FGameLiftServerSDKModule* GameLiftModule;
+
+    // Immutable matchmaker view of the current session, swapped on start/update.
+    FGameLiftMatchmakerDataPtr MatchmakerData;
+
+    // A session start that arrived while ProcessReady was still in flight; replayed on reaching Ready
+    TOptional<Aws::GameLift::Server::Model::GameSession> DeferredGameSessionStart;
 #endif
 
     // Error tracking
@@ -281,8 +497,21 @@ private:
     int32 ConsecutiveInitFailures;
     FDateTime LastInitAttemptTime;
 
+    // Start-up readiness
+    EGameLiftStartupSignal StartupSignals;
+    bool bProcessReadyRequested;
+    TSharedPtr<struct FStreamableHandle> StartupPrewarmHandle;
+
+    // Match content loaded between ProcessReady and session activation
+    FGameLiftWorldPrewarm WorldPrewarm;
+    double SessionStartRequestedSeconds;
+    double RecycleStartedSeconds;
+    // Times the process has re-registered after a recycle; suffixes the Anywhere process ID
+    int32 NumProcessReregistrations;
+
     // Constants
-    static constexpr int32 MAX_TICK_RATE_SAMPLES = 60;
     static constexpr float TICK_RATE_UPDATE_INTERVAL = 1.0f;
+    static constexpr int32 GAME_THREAD_COMMAND_CAPACITY = 64;
+    static constexpr double GAME_THREAD_COMMAND_BUDGET_SECONDS = 0.002;
 	
 };